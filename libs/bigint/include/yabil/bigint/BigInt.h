@@ -167,6 +167,23 @@ public:
     /// @return Quotient and remainder as \p std::pair of \p std::BigInt
     YABIL_BIGINT_EXPORT std::pair<BigInt, BigInt> divide(const BigInt &other) const;
 
+    /// @brief Perform division which is known to be exact.
+    /// @details Uses Hensel (2-adic) division, which computes quotient starting from the lowest digits and needs
+    ///          neither remainder nor quotient corrections. Result is unspecified if \p other does not divide number.
+    /// @throws std::invalid_argument when \p other is 0
+    /// @param other \p BigInt Divisor
+    /// @return Quotient
+    YABIL_BIGINT_EXPORT BigInt divexact(const BigInt &other) const;
+
+    /// @brief Check if number is divisible by other number without computing remainder.
+    /// @details Every number divides 0, while 0 divides only itself.
+    /// @param other \p BigInt Divisor
+    /// @return \p true if \p other divides number and \p false otherwise
+    YABIL_BIGINT_EXPORT bool is_divisible_by(const BigInt &other) const;
+
+    /// @copydoc yabil::bigint::BigInt::is_divisible_by(const BigInt &) const
+    YABIL_BIGINT_EXPORT bool is_divisible_by(bigint_base_t other) const;
+
     /// @brief Check if absolute value of number is greater than other number
     /// @param other Other \p BigInt number
     /// @return \p true if absolute value of number is greater than other and \p false otherwise
@@ -362,6 +379,7 @@ private:
     YABIL_BIGINT_EXPORT void normalize();
     std::pair<BigInt, BigInt> divide_unsigned(const BigInt &other) const;
     std::pair<BigInt, BigInt> unbalanced_div(const BigInt &other) const;
+    std::pair<BigInt, BigInt> short_quotient_div(const BigInt &other) const;
     std::pair<BigInt, BigInt> recursive_div(const BigInt &other) const;
 
     BigInt &inplace_plain_add(const BigInt &other);
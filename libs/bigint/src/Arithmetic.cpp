@@ -5,6 +5,7 @@
 #include <yabil/utils/TypeUtils.h>
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
 #include <limits>
 #include <vector>
@@ -19,6 +20,20 @@ void remove_trailing_zeros(std::vector<bigint_base_t> &data)
     data.erase(std::find_if(data.rbegin(), data.rend(), [](const auto &v) { return v != 0; }).base(), data.end());
 }
 
+std::size_t trailing_zero_bits(std::span<bigint_base_t const> data)
+{
+    std::size_t zeros = 0;
+    for (const auto digit : data)
+    {
+        if (digit != 0)
+        {
+            return zeros + static_cast<std::size_t>(std::countr_zero(digit));
+        }
+        zeros += bigint_base_t_size_bits;
+    }
+    return zeros;
+}
+
 bool is_normalized_for_division(const BigInt &n)
 {
     return n.get_bit(n.byte_size() * 8 - 1);
@@ -91,8 +106,79 @@ std::vector<bigint_base_t> mul_basecase(std::span<bigint_base_t const> a, std::s
     return result;
 }
 
+std::vector<bigint_base_t> sqr_basecase(std::span<bigint_base_t const> a)
+{
+    const std::size_t n = a.size();
+    std::vector<bigint_base_t> result(2 * n, 0);
+
+    // Every cross product a[i] * a[j] (i < j) is computed once and doubled
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        utils::double_width_t<bigint_base_t> carry = 0;
+        for (std::size_t j = i + 1; j < n; ++j)
+        {
+            carry += result[i + j] + utils::safe_mul(a[i], a[j]);
+            result[i + j] = static_cast<bigint_base_t>(carry);
+            carry >>= bigint_base_t_size_bits;
+        }
+        result[i + n] = static_cast<bigint_base_t>(carry);
+    }
+
+    bigint_base_t top_bit = 0;
+    for (auto &digit : result)
+    {
+        const auto next_top_bit = static_cast<bigint_base_t>(digit >> (bigint_base_t_size_bits - 1));
+        digit = static_cast<bigint_base_t>((digit << 1) | top_bit);
+        top_bit = next_top_bit;
+    }
+
+    utils::double_width_t<bigint_base_t> carry = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto square = utils::safe_mul(a[i], a[i]);
+        carry += static_cast<utils::double_width_t<bigint_base_t>>(result[2 * i]) + static_cast<bigint_base_t>(square);
+        result[2 * i] = static_cast<bigint_base_t>(carry);
+        carry >>= bigint_base_t_size_bits;
+
+        carry += static_cast<utils::double_width_t<bigint_base_t>>(result[2 * i + 1]) +
+                 static_cast<bigint_base_t>(square >> bigint_base_t_size_bits);
+        result[2 * i + 1] = static_cast<bigint_base_t>(carry);
+        carry >>= bigint_base_t_size_bits;
+    }
+
+    return result;
+}
+
+std::vector<bigint_base_t> karatsuba_sqr(std::span<bigint_base_t const> a)
+{
+    if (a.size() < BigIntGlobalConfig::thresholds().karatsuba_threshold_digits)
+    {
+        return sqr_basecase(a);
+    }
+
+    const int m2 = static_cast<int>(a.size() / 2);
+
+    const std::span<bigint_base_t const> low = utils::make_span(a.begin(), a.begin() + m2);
+    const std::span<bigint_base_t const> high = utils::make_span(a.begin() + m2, a.end());
+    const auto lh = plain_add(low, high);
+
+    const auto z0 = BigInt(karatsuba_sqr(low));
+    const auto z1 = BigInt(karatsuba_sqr(lh));
+    const auto z2 = BigInt(karatsuba_sqr(high));
+
+    constexpr auto digit_bit_size = std::numeric_limits<bigint_base_t>::digits;
+    const uint64_t shift_val = static_cast<uint64_t>(m2) * digit_bit_size;
+    auto result = (z2 << (shift_val * 2UL)) + ((z1 - z2 - z0) << shift_val) + z0;
+    return result.raw_data();
+}
+
 std::vector<bigint_base_t> karatsuba_mul(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b)
 {
+    if (a.data() == b.data() && a.size() == b.size())
+    {
+        return karatsuba_sqr(a);
+    }
+
     if (a.size() < BigIntGlobalConfig::thresholds().karatsuba_threshold_digits ||
         b.size() < BigIntGlobalConfig::thresholds().karatsuba_threshold_digits)
     {
@@ -120,6 +206,141 @@ std::vector<bigint_base_t> karatsuba_mul(std::span<bigint_base_t const> a, std::
     return result.raw_data();
 }
 
+/// Inverse of odd digit modulo 2^bigint_base_t_size_bits, computed with Newton iteration.
+bigint_base_t digit_inverse(bigint_base_t d)
+{
+    using double_digit_t = utils::double_width_t<bigint_base_t>;
+
+    // Every odd number is its own inverse modulo 8
+    bigint_base_t inverse = d;
+    for (std::size_t correct_bits = 3; correct_bits < bigint_base_t_size_bits; correct_bits *= 2)
+    {
+        const auto correction = static_cast<bigint_base_t>(2 - static_cast<double_digit_t>(d) * inverse);
+        inverse = static_cast<bigint_base_t>(static_cast<double_digit_t>(inverse) * correction);
+    }
+    return inverse;
+}
+
+namespace
+{
+
+/// Hensel (2-adic) division by odd b (Jebelean): q = a / b mod B^quotient_size, found from the lowest digit by single
+/// multiplication each, so there is no trial quotient nor correction. a - q * b is computed modulo B^limit, negative
+/// is set when it underflows.
+std::vector<bigint_base_t> hensel_div_basecase(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b,
+                                               std::size_t quotient_size, std::size_t limit, bool &negative)
+{
+    const bigint_base_t inverse = digit_inverse(b.front());
+
+    std::vector<bigint_base_t> remainder(limit);
+    std::copy(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(std::min(a.size(), limit)), remainder.begin());
+    std::vector<bigint_base_t> quotient(quotient_size);
+    negative = false;
+
+    for (std::size_t i = 0; i < quotient_size; ++i)
+    {
+        const auto q = static_cast<bigint_base_t>(utils::safe_mul(remainder[i], inverse));
+        quotient[i] = q;
+
+        // remainder -= q * b * B^i
+        utils::double_width_t<bigint_base_t> carry = 0;
+        std::size_t j = 0;
+        for (; j < b.size() && i + j < limit; ++j)
+        {
+            carry += utils::safe_mul(q, b[j]);
+            const auto product_digit = static_cast<bigint_base_t>(carry);
+            carry >>= bigint_base_t_size_bits;
+            carry += remainder[i + j] < product_digit;
+            remainder[i + j] = static_cast<bigint_base_t>(remainder[i + j] - product_digit);
+        }
+        for (j += i; carry != 0 && j < limit; ++j)
+        {
+            const auto borrow = static_cast<bigint_base_t>(carry);
+            carry = remainder[j] < borrow;
+            remainder[j] = static_cast<bigint_base_t>(remainder[j] - borrow);
+        }
+        negative = negative || carry != 0;
+    }
+
+    if (limit > quotient_size)
+    {
+        negative = negative || std::any_of(remainder.begin() + static_cast<std::ptrdiff_t>(quotient_size),
+                                           remainder.end(), [](auto digit) { return digit != 0; });
+    }
+    return quotient;
+}
+
+/// Hensel division q = a / b mod B^n by halves: q0 = a / b mod B^h, q1 = ((a - q0 * b) / B^h) / b mod B^(n - h).
+/// Low half of q is known before the high one, so only multiplication of q0 by b is needed besides the two halves.
+std::vector<bigint_base_t> hensel_div_recursive(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b,
+                                                std::size_t n)
+{
+    // Digits above n do not affect the quotient modulo B^n
+    a = a.first(std::min(a.size(), n));
+    b = b.first(std::min(b.size(), n));
+
+    if (n <= 2 * BigIntGlobalConfig::thresholds().karatsuba_threshold_digits)
+    {
+        bool negative = false;
+        return hensel_div_basecase(a, b, n, n, negative);
+    }
+
+    const std::size_t h = n / 2;
+    auto quotient = hensel_div_recursive(a, b, h);
+
+    auto low_quotient = quotient;
+    remove_trailing_zeros(low_quotient);
+    const auto product = low_quotient.empty() ? std::vector<bigint_base_t>() : karatsuba_mul(low_quotient, b);
+
+    // Digits [h, n) of a - q0 * b, lower digits are zeros
+    std::vector<bigint_base_t> remainder(n - h);
+    bigint_base_t borrow = 0;
+    for (std::size_t i = 0; i < remainder.size(); ++i)
+    {
+        const auto a_digit = h + i < a.size() ? a[h + i] : bigint_base_t{0};
+        const auto product_digit = h + i < product.size() ? product[h + i] : bigint_base_t{0};
+        const auto difference = static_cast<bigint_base_t>(a_digit - product_digit);
+        remainder[i] = static_cast<bigint_base_t>(difference - borrow);
+        borrow = (a_digit < product_digit) || (difference < borrow);
+    }
+
+    const auto high_quotient = hensel_div_recursive(remainder, b, n - h);
+    quotient.insert(quotient.end(), high_quotient.begin(), high_quotient.end());
+    return quotient;
+}
+
+}  // namespace
+
+/// Exact division of a by odd b: q = a / b mod B^(a.size() - b.size() + 1). When divisible is given, a - q * b is
+/// checked in full, it is zero iff b divides a.
+std::vector<bigint_base_t> hensel_div(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b,
+                                      bool *divisible)
+{
+    const std::size_t quotient_size = a.size() - b.size() + 1;
+    std::vector<bigint_base_t> quotient;
+
+    // Basecase costs quotient_size * b.size() operations, so it is used when any of them is small
+    if (std::min(quotient_size, b.size()) <= 2 * BigIntGlobalConfig::thresholds().karatsuba_threshold_digits)
+    {
+        bool negative = false;
+        quotient = hensel_div_basecase(a, b, quotient_size, divisible ? a.size() : quotient_size, negative);
+        if (divisible)
+        {
+            *divisible = !negative;
+        }
+        remove_trailing_zeros(quotient);
+        return quotient;
+    }
+
+    quotient = hensel_div_recursive(a, b, quotient_size);
+    remove_trailing_zeros(quotient);
+    if (divisible)
+    {
+        *divisible = !quotient.empty() && BigInt(karatsuba_mul(quotient, b)) == BigInt(a);
+    }
+    return quotient;
+}
+
 std::vector<bigint_base_t> &increment_unsigned(std::vector<bigint_base_t> &n)
 {
     bigint_base_t carry = 1;
@@ -2,6 +2,7 @@
 
 #include <yabil/bigint/BigInt.h>
 
+#include <cstddef>
 #include <span>
 #include <utility>
 #include <vector>
@@ -10,6 +11,7 @@ namespace yabil::bigint
 {
 
 void remove_trailing_zeros(std::vector<bigint_base_t> &data);
+std::size_t trailing_zero_bits(std::span<bigint_base_t const> data);
 
 bool is_normalized_for_division(const BigInt &n);
 
@@ -24,6 +26,12 @@ std::vector<bigint_base_t> plain_sub(std::span<bigint_base_t const> a, std::span
 
 std::vector<bigint_base_t> mul_basecase(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b);
 std::vector<bigint_base_t> karatsuba_mul(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b);
+std::vector<bigint_base_t> sqr_basecase(std::span<bigint_base_t const> a);
+std::vector<bigint_base_t> karatsuba_sqr(std::span<bigint_base_t const> a);
+
+bigint_base_t digit_inverse(bigint_base_t d);
+std::vector<bigint_base_t> hensel_div(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b,
+                                      bool *divisible = nullptr);
 
 std::vector<bigint_base_t> &increment_unsigned(std::vector<bigint_base_t> &n);
 std::vector<bigint_base_t> &decrement_unsigned(std::vector<bigint_base_t> &n);
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <functional>
 #include <iostream>
+#include <utility>
 
 #include "Arithmetic.h"
 #include "StringConversionUtils.h"
@@ -18,7 +19,7 @@ BigInt::BigInt(const std::vector<bigint_base_t> &raw_data, Sign sign) : data(raw
     normalize();
 }
 
-BigInt::BigInt(std::vector<bigint_base_t> &&raw_data, Sign sign) : data(raw_data), sign(sign)
+BigInt::BigInt(std::vector<bigint_base_t> &&raw_data, Sign sign) : data(std::move(raw_data)), sign(sign)
 {
     normalize();
 }
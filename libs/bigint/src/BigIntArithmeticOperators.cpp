@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <bit>
 #include <limits>
+#include <span>
 #include <stdexcept>
 
 #include "Arithmetic.h"
@@ -14,8 +15,44 @@
 namespace yabil::bigint
 {
 
+namespace
+{
+
+/// Get number built from digits [begin, end) of data, digits above data size are zeros.
+BigInt digits_range(const std::vector<bigint_base_t> &data, std::size_t begin, std::size_t end)
+{
+    end = std::min(end, data.size());
+    if (begin >= end)
+    {
+        return BigInt();
+    }
+    return BigInt(std::span<bigint_base_t const>(data).subspan(begin, end - begin));
+}
+
+/// Check divisibility by odd digit: c is the borrow of Hensel division a - q * d, it is 0 at the end iff d divides a.
+bool is_divisible_by_odd_digit(std::span<bigint_base_t const> a, bigint_base_t d)
+{
+    const bigint_base_t inverse = digit_inverse(d);
+    bigint_base_t c = 0;
+    for (const auto digit : a)
+    {
+        const bool borrow = digit < c;
+        const auto q = static_cast<bigint_base_t>(utils::safe_mul(static_cast<bigint_base_t>(digit - c), inverse));
+        c = static_cast<bigint_base_t>((utils::safe_mul(q, d) >> bigint_base_t_size_bits) + borrow);
+    }
+    return c == 0;
+}
+
+}  // namespace
+
 std::pair<BigInt, BigInt> BigInt::divide_unsigned(const BigInt &other) const
 {
+    if (other.data.size() > BigIntGlobalConfig::thresholds().recursive_div_threshold_digits &&
+        data.size() < 2 * other.data.size() - 2)
+    {
+        return short_quotient_div(other);
+    }
+
     if (data.size() > BigIntGlobalConfig::thresholds().recursive_div_threshold_digits &&
         other.data.size() > BigIntGlobalConfig::thresholds().recursive_div_threshold_digits)
     {
@@ -35,18 +72,43 @@ std::pair<BigInt, BigInt> BigInt::unbalanced_div(const BigInt &other) const
 
     while (m > n)
     {
-        const BigInt A_div{std::vector<bigint_base_t>(A.data.cbegin() + (m - n), A.data.cend())};
+        const auto A_div = digits_range(A.data, static_cast<std::size_t>(m - n), A.data.size());
         const auto [q, r] = A_div.recursive_div(other);
 
         Q = (Q << (digit_bit_size * n)) + q;
-        A = (r << (digit_bit_size * (m - n))) +
-            BigInt{std::vector<bigint_base_t>(A.data.cbegin(), A.data.cbegin() + (m - n))};
+        A = (r << (digit_bit_size * (m - n))) + digits_range(A.data, 0, static_cast<std::size_t>(m - n));
         m -= n;
     }
     const auto [q, r] = A.recursive_div(other);
     return {(Q << (digit_bit_size * m)) + q, r};
 }
 
+std::pair<BigInt, BigInt> BigInt::short_quotient_div(const BigInt &other) const
+{
+    // Quotient has at most m + 1 digits, so only top m + 2 digits of the divisor are needed to estimate it.
+    // For normalized divisor the estimate is never lower than the quotient and exceeds it by at most 2.
+    const int n = static_cast<int>(other.data.size());
+    const int m = static_cast<int>(data.size()) - n;
+
+    if (m < 0)
+    {
+        return {BigInt(), *this};
+    }
+
+    const int t = n - m - 2;
+    auto Q = BigInt{std::vector<bigint_base_t>(data.cbegin() + t, data.cend())}
+                 .divide_unsigned(BigInt{std::vector<bigint_base_t>(other.data.cbegin() + t, other.data.cend())})
+                 .first;
+    auto R = *this - Q * other;
+
+    while (R.is_negative())
+    {
+        --Q;
+        R += other;
+    }
+    return {Q, R};
+}
+
 std::pair<BigInt, BigInt> BigInt::recursive_div(const BigInt &other) const
 {
     constexpr uint64_t digit_bit_size = static_cast<uint64_t>(bigint_base_t_size_bits);
@@ -74,9 +136,8 @@ std::pair<BigInt, BigInt> BigInt::recursive_div(const BigInt &other) const
         A_prim += other << (digit_bit_size * k);
     }
 
-    auto [Q0, R0] = BigInt{std::vector<bigint_base_t>(A_prim.data.cbegin() + k, A_prim.data.cend())}.recursive_div(B1);
-    auto A_bis = (R0 << (digit_bit_size * k)) +
-                 BigInt{std::vector<bigint_base_t>(A_prim.data.cbegin(), A_prim.data.cbegin() + k)} - Q0 * B0;
+    auto [Q0, R0] = digits_range(A_prim.data, static_cast<std::size_t>(k), A_prim.data.size()).recursive_div(B1);
+    auto A_bis = (R0 << (digit_bit_size * k)) + digits_range(A_prim.data, 0, static_cast<std::size_t>(k)) - Q0 * B0;
     while (A_bis.is_negative())
     {
         --Q0;
@@ -108,11 +169,13 @@ std::pair<BigInt, BigInt> BigInt::base_div(const BigInt &other) const
         q[m] = 1;
     }
 
+    // Remainder is normalized after every step, so its leading digits may be already removed
+    const auto digit_at = [&A](int index) -> utils::double_width_t<bigint_base_t>
+    { return static_cast<std::size_t>(index) < A.data.size() ? A.data[static_cast<std::size_t>(index)] : 0; };
+
     for (int i = m - 1; i >= 0; --i)
     {
-        const auto top_two_digits =
-            (static_cast<utils::double_width_t<bigint_base_t>>(A.data[n + i]) << bigint_base_t_size_bits) |
-            static_cast<utils::double_width_t<bigint_base_t>>(A.data[n + i - 1]);
+        const auto top_two_digits = (digit_at(n + i) << bigint_base_t_size_bits) | digit_at(n + i - 1);
 
         const auto quotient_part = top_two_digits / B.data[n - 1];
         auto q_i = std::min(quotient_part,
@@ -190,7 +253,7 @@ BigInt BigInt::operator%(const BigInt &other) const
     if (other.data.size() == 1 && other.sign == Sign::Plus &&
         other.data.front() < std::numeric_limits<utils::half_width_t<bigint_base_t>>::max())
     {
-        return BigInt((*this) % other.data.front());
+        return BigInt((*this) % other.data.front(), sign);
     }
 
     return divide(other).second;
@@ -259,10 +322,89 @@ std::pair<BigInt, BigInt> BigInt::divide(const BigInt &other) const
     return divide_unsigned(other);
 }
 
+BigInt BigInt::divexact(const BigInt &other) const
+{
+    if (other.is_zero())
+    {
+        throw std::invalid_argument("Cannot divide by 0");
+    }
+
+    // a / (b * 2^k) = (a / b) / 2^k, so only odd part of the divisor is needed
+    const auto twos = trailing_zero_bits(other.data);
+    const auto odd_divisor = twos == 0 ? BigInt() : other.abs() >> twos;
+    const std::span<bigint_base_t const> a(data);
+    const std::span<bigint_base_t const> b(twos == 0 ? other.data : odd_divisor.data);
+
+    if (a.size() < b.size())
+    {
+        return BigInt();
+    }
+
+    auto result = BigInt(hensel_div(a, b)) >> twos;
+    if (sign != other.sign && !result.is_zero())
+    {
+        result.sign = Sign::Minus;
+    }
+    return result;
+}
+
+bool BigInt::is_divisible_by(const BigInt &other) const
+{
+    if (other.is_zero() || is_zero())
+    {
+        return is_zero();
+    }
+
+    // b * 2^k divides a iff both b and 2^k divide a
+    const auto twos = trailing_zero_bits(other.data);
+    if (trailing_zero_bits(data) < twos)
+    {
+        return false;
+    }
+
+    const auto odd_divisor = twos == 0 ? BigInt() : other.abs() >> twos;
+    const std::span<bigint_base_t const> a(data);
+    const std::span<bigint_base_t const> b(twos == 0 ? other.data : odd_divisor.data);
+
+    if (a.size() < b.size())
+    {
+        return false;
+    }
+
+    if (b.size() == 1)
+    {
+        return is_divisible_by_odd_digit(a, b.front());
+    }
+
+    bool divisible = false;
+    hensel_div(a, b, &divisible);
+    return divisible;
+}
+
+bool BigInt::is_divisible_by(bigint_base_t other) const
+{
+    if (other == 0 || is_zero())
+    {
+        return is_zero();
+    }
+
+    const auto twos = std::countr_zero(other);
+    if (trailing_zero_bits(data) < static_cast<std::size_t>(twos))
+    {
+        return false;
+    }
+
+    const auto odd_divisor = static_cast<bigint_base_t>(other >> twos);
+    return odd_divisor == 1 || is_divisible_by_odd_digit(data, odd_divisor);
+}
+
 BigInt BigInt::operator-() const
 {
     BigInt result(*this);
-    result.sign = (sign == Sign::Plus) ? Sign::Minus : Sign::Plus;
+    if (!is_zero())
+    {
+        result.sign = (sign == Sign::Plus) ? Sign::Minus : Sign::Plus;
+    }
     return result;
 }
 
@@ -273,13 +415,6 @@ BigInt &BigInt::operator+=(const BigInt &other)
         return inplace_plain_add(other);
     }
 
-    if (sign == Sign::Minus)
-    {
-        inplace_plain_sub(other);
-        sign = (sign == Sign::Minus) ? Sign::Plus : Sign::Minus;
-        return *this;
-    }
-
     return inplace_plain_sub(other);
 }
 
@@ -290,13 +425,7 @@ BigInt &BigInt::operator-=(const BigInt &other)
         return inplace_plain_add(other);
     }
 
-    if (sign == Sign::Plus)
-    {
-        return inplace_plain_sub(other);
-    }
-
-    inplace_plain_sub(other);
-    return *this;
+    return inplace_plain_sub(other);
 }
 
 BigInt &BigInt::operator*=(const BigInt &other)
@@ -398,7 +527,7 @@ BigInt &BigInt::inplace_plain_sub(const BigInt &other)
     if (abs_lower(other))
     {
         std::swap(longer, shorter);
-        sign = Sign::Minus;
+        sign = (sign == Sign::Minus) ? Sign::Plus : Sign::Minus;
     }
 
     data.resize(longer->data.size());
@@ -173,10 +173,11 @@ BigInt &BigInt::operator<<=(uint64_t shift)
     const uint64_t new_items_count = shift / bigint_base_t_size_bits;
     const uint64_t real_shift = shift % bigint_base_t_size_bits;
 
-    data.resize(data.size() + new_items_count + 1);
+    data.insert(data.begin(), new_items_count, 0);
+    data.push_back(0);
     bigint_base_t shifted_val = 0;
 
-    std::transform(data.cbegin(), data.cend() - static_cast<int>(new_items_count) - 1,
+    std::transform(data.cbegin() + static_cast<int>(new_items_count), data.cend() - 1,
                    data.begin() + static_cast<int>(new_items_count),
                    [real_shift, &shifted_val](const bigint_base_t &v)
                    {
@@ -187,11 +188,6 @@ BigInt &BigInt::operator<<=(uint64_t shift)
                        return transformed;
                    });
 
-    if (new_items_count > 0)
-    {
-        std::fill(data.begin(), data.begin() + static_cast<int>(new_items_count), 0);
-    }
-
     data.back() = shifted_val;
     normalize();
 
@@ -210,7 +206,7 @@ BigInt &BigInt::operator>>=(uint64_t shift)
         return *this;
     }
 
-    data.resize(data.size() - removed_items_count);
+    data.erase(data.begin(), data.begin() + static_cast<int>(removed_items_count));
     bigint_base_t shifted_val = 0;
 
     std::transform(data.crbegin(), data.crend(), data.rbegin(),
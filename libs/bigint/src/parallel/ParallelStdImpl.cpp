@@ -25,13 +25,12 @@ void set_thread_count(std::size_t thread_count)
 
 std::vector<bigint_base_t> parallel_add_unsigned(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b)
 {
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
     const auto min_s = std::min(a.size(), b.size());
-    if (min_s < BigIntGlobalConfig::thresholds().parallel_add_digits)
+    if (min_s < BigIntGlobalConfig::thresholds().parallel_add_digits || thread_pool.is_current_thread_worker())
     {
         return plain_add(a, b);
     }
-
-    auto &thread_pool = utils::ThreadPoolSingleton::instance();
     const auto concurrency = std::min(min_s, thread_pool.thread_count());
     const auto chunk_size = min_s / concurrency;
 
@@ -85,8 +84,9 @@ std::vector<bigint_base_t> parallel_add_unsigned(std::span<bigint_base_t const>
 
 std::vector<bigint_base_t> parallel_karatsuba(std::span<bigint_base_t const> a, std::span<bigint_base_t const> b)
 {
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
     if (a.size() < BigIntGlobalConfig::thresholds().parallel_mul_digits ||
-        b.size() < BigIntGlobalConfig::thresholds().parallel_mul_digits)
+        b.size() < BigIntGlobalConfig::thresholds().parallel_mul_digits || thread_pool.is_current_thread_worker())
     {
         return karatsuba_mul(a, b);
     }
@@ -105,13 +105,15 @@ std::vector<bigint_base_t> parallel_karatsuba(std::span<bigint_base_t const> a,
     const std::span<bigint_base_t const> low2 = utils::make_span(b.begin(), utils::safe_advance(b.begin(), m2, b));
     const std::span<bigint_base_t const> high2 = utils::make_span(utils::safe_advance(b.begin(), m2, b), b.end());
 
-    auto &thread_pool = utils::ThreadPoolSingleton::instance();
-
     auto w_z0 = thread_pool.submit([&]() { return karatsuba_mul(low1, low2); });
     auto w_z1 = thread_pool.submit(
         [&]()
         {
             const auto lh1 = plain_add(low1, high1);
+            if (a.data() == b.data() && a.size() == b.size())
+            {
+                return karatsuba_mul(lh1, lh1);
+            }
             const auto lh2 = plain_add(low2, high2);
             return karatsuba_mul(lh1, lh2);
         });
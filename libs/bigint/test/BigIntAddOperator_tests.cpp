@@ -162,6 +162,31 @@ TEST_F(BigIntAddOperator_tests, addInPlaceTwoNegativeWithOverflow)
     EXPECT_EQ(Sign::Minus, big_int1.get_sign());
 }
 
+TEST_F(BigIntAddOperator_tests, addInPlaceNumbersWithDifferentSigns)
+{
+    {
+        BigInt a(-5);
+        a += BigInt(3);
+        EXPECT_EQ(BigInt(-2), a);
+    }
+    {
+        BigInt a(-5);
+        a += BigInt(5);
+        EXPECT_EQ(BigInt(), a);
+        EXPECT_EQ(Sign::Plus, a.get_sign());
+    }
+    {
+        BigInt a(-3);
+        a += BigInt(5);
+        EXPECT_EQ(BigInt(2), a);
+    }
+    {
+        BigInt a(BigInt(1) << 200);
+        a += -(BigInt(1) << 201);
+        EXPECT_EQ(-(BigInt(1) << 200), a);
+    }
+}
+
 TEST_F(BigIntAddOperator_tests, canAddNegatedNumber)
 {
     const BigInt a(12031023ULL, Sign::Minus);
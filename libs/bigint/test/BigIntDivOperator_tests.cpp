@@ -66,6 +66,22 @@ TEST_F(BigIntDivOperator_tests, divTwoNonZeroGetRemainder)
     EXPECT_EQ(10, (big_int1 % big_int2).to_int());
 }
 
+TEST_F(BigIntDivOperator_tests, remainderOfNegativeNumberBySingleDigit)
+{
+    const BigInt big_int1("-1905640896534565229690880"), big_int2(919);
+    EXPECT_EQ(BigInt(-718), big_int1 % big_int2);
+    EXPECT_EQ(BigInt(0), BigInt("-1905640896534565229690880") % BigInt(10));
+    EXPECT_FALSE((BigInt("-1905640896534565229690880") % BigInt(10)).is_negative());
+}
+
+TEST_F(BigIntDivOperator_tests, remainderOfNegativeMultipleIsNotNegative)
+{
+    const BigInt divisor("340282366920938463463374607431768211507");
+    const auto remainder = (-(divisor * BigInt("123456789012345678901234567890"))) % divisor;
+    EXPECT_TRUE(remainder.is_zero());
+    EXPECT_FALSE(remainder.is_negative());
+}
+
 TEST_F(BigIntDivOperator_tests, divTwoNonZeroGetQuotientAndRemainder)
 {
     const BigInt big_int1(50), big_int2(20);
@@ -335,3 +351,134 @@ TEST_F(BigIntDivOperator_tests, divHugeUnbalancedNumbers_4)
     EXPECT_EQ(expected_quotioent, quotient);
     EXPECT_EQ(expected_remainder, remainder);
 }
+
+TEST_F(BigIntDivOperator_tests, divHugeNumbersWithShortQuotient)
+{
+    const BigInt divisor = (BigInt(1) << (bigint_base_t_size_bits * 3000)) - BigInt(12345);
+    const BigInt quotient = (BigInt(1) << (bigint_base_t_size_bits * 100)) + BigInt(987654321);
+
+    for (const auto &remainder : {BigInt(0), BigInt(1), divisor - BigInt(1), divisor >> 7})
+    {
+        const auto [q, r] = (quotient * divisor + remainder).divide(divisor);
+        EXPECT_EQ(quotient, q);
+        EXPECT_EQ(remainder, r);
+    }
+}
+
+TEST_F(BigIntDivOperator_tests, divHugeSparseNumbers)
+{
+    // Intermediate remainders of recursive division are much shorter than the divisor here
+    const BigInt a = (BigInt(3) << 100000) + (BigInt(5) << 33333) + BigInt(12345);
+    const BigInt b = (BigInt(7) << 100000) + (BigInt(11) << 50000) + BigInt(1);
+
+    const auto [quotient, remainder] = (a * b).divide(b);
+    EXPECT_EQ(a, quotient);
+    EXPECT_EQ(BigInt(0), remainder);
+
+    const auto [quotient_2, remainder_2] = (a * b + BigInt(5)).divide(a);
+    EXPECT_EQ(b, quotient_2);
+    EXPECT_EQ(BigInt(5), remainder_2);
+}
+
+TEST_F(BigIntDivOperator_tests, divexactOfProducts)
+{
+    const BigInt a("340282366920938463463374607431768211507123456789");
+    const BigInt b("98765432109876543210987654321098765432109876543210");
+    const BigInt c = (BigInt(1) << 700) + BigInt(12345);
+
+    EXPECT_EQ(a, (a * b).divexact(b));
+    EXPECT_EQ(b, (a * b).divexact(a));
+    EXPECT_EQ(c, (c * b).divexact(b));
+    EXPECT_EQ(b, (c * b).divexact(c));
+    EXPECT_EQ(BigInt(1), c.divexact(c));
+    EXPECT_EQ(BigInt(0), BigInt(0).divexact(c));
+    EXPECT_EQ(BigInt(12345), (c * BigInt(12345)).divexact(c));
+}
+
+TEST_F(BigIntDivOperator_tests, divexactWithEvenDivisor)
+{
+    const BigInt a("340282366920938463463374607431768211507123456789");
+    const BigInt b = BigInt("98765432109876543210987654321") << 130;
+
+    EXPECT_EQ(a, (a * b).divexact(b));
+    EXPECT_EQ(b, (a * b).divexact(a));
+    EXPECT_EQ(a << 3, (a << 200).divexact(BigInt(1) << 197));
+    EXPECT_EQ(BigInt(7), BigInt(56).divexact(BigInt(8)));
+}
+
+TEST_F(BigIntDivOperator_tests, divexactKeepsSign)
+{
+    const BigInt a("340282366920938463463374607431768211507123456789");
+    const BigInt b("-98765432109876543210987654321098765432109876543210");
+
+    EXPECT_EQ(-a, (a * b).divexact(-b));
+    EXPECT_EQ(a, (a * b).divexact(b));
+    EXPECT_EQ(-b, (-a * b).divexact(a));
+}
+
+TEST_F(BigIntDivOperator_tests, divexactOfHugeNumbers)
+{
+    const BigInt a = (BigInt(3) << 90000) + (BigInt(5) << 40000) + BigInt(12345);
+    const BigInt b = (BigInt(7) << 85000) + (BigInt(11) << 3000) + BigInt(1);
+
+    EXPECT_EQ(a, (a * b).divexact(b));
+    EXPECT_EQ(b, (a * b).divexact(a));
+    EXPECT_EQ(a, (a * (b << 5)).divexact(b << 5));
+}
+
+TEST_F(BigIntDivOperator_tests, divexactByZeroThrows)
+{
+    ASSERT_THROW(BigInt(10).divexact(BigInt(0)), std::invalid_argument);
+}
+
+TEST_F(BigIntDivOperator_tests, isDivisibleBy)
+{
+    const BigInt a("340282366920938463463374607431768211507123456789");
+    const BigInt b("98765432109876543210987654321098765432109876543210");
+    const BigInt product = a * b;
+
+    EXPECT_TRUE(product.is_divisible_by(a));
+    EXPECT_TRUE(product.is_divisible_by(b));
+    EXPECT_TRUE(product.is_divisible_by(-b));
+    EXPECT_TRUE((-product).is_divisible_by(b));
+    EXPECT_TRUE(product.is_divisible_by(product));
+    EXPECT_FALSE(product.is_divisible_by(product + BigInt(1)));
+    EXPECT_FALSE((product + BigInt(1)).is_divisible_by(a));
+    EXPECT_TRUE((product + a * BigInt(2)).is_divisible_by(a * BigInt(4)));
+    EXPECT_FALSE((product + a).is_divisible_by(a * BigInt(2)));
+    EXPECT_FALSE((product - a).is_divisible_by(b));
+    EXPECT_FALSE(a.is_divisible_by(product));
+    EXPECT_TRUE(BigInt(0).is_divisible_by(a));
+    EXPECT_TRUE(BigInt(0).is_divisible_by(BigInt(0)));
+    EXPECT_FALSE(a.is_divisible_by(BigInt(0)));
+}
+
+TEST_F(BigIntDivOperator_tests, isDivisibleByHugeNumber)
+{
+    const BigInt a = (BigInt(3) << 90000) + (BigInt(5) << 40000) + BigInt(12345);
+    const BigInt b = (BigInt(7) << 85000) + (BigInt(11) << 3000) + BigInt(1);
+
+    EXPECT_TRUE((a * b).is_divisible_by(b));
+    EXPECT_TRUE((a * b).is_divisible_by(a));
+    EXPECT_FALSE((a * b + BigInt(1)).is_divisible_by(b));
+    EXPECT_FALSE((a * b + (BigInt(1) << 100000)).is_divisible_by(a));
+}
+
+TEST_F(BigIntDivOperator_tests, isDivisibleByDigit)
+{
+    const BigInt a("340282366920938463463374607431768211507123456789");
+
+    EXPECT_TRUE((a * BigInt(7)).is_divisible_by(bigint_base_t{7}));
+    EXPECT_TRUE((a * BigInt(96)).is_divisible_by(bigint_base_t{96}));
+    EXPECT_TRUE((a << 5).is_divisible_by(bigint_base_t{32}));
+    EXPECT_FALSE((a * BigInt(7) + BigInt(1)).is_divisible_by(bigint_base_t{7}));
+    EXPECT_FALSE((a * BigInt(3) << 4).is_divisible_by(bigint_base_t{96}));
+    EXPECT_TRUE(a.is_divisible_by(bigint_base_t{1}));
+    EXPECT_FALSE(a.is_divisible_by(bigint_base_t{0}));
+    EXPECT_TRUE(BigInt(0).is_divisible_by(bigint_base_t{0}));
+
+    for (bigint_base_t d = 1; d < 200; ++d)
+    {
+        EXPECT_EQ((a % BigInt(d)).is_zero(), a.is_divisible_by(d));
+    }
+}
@@ -282,3 +282,14 @@ TYPED_TEST(BigIntMulOperator_tests, mulAEqualB)
     EXPECT_EQ(expected, result);
     EXPECT_EQ(expected, b * a);
 }
+
+TYPED_TEST(BigIntMulOperator_tests, squareMatchesMultiplicationOfDifferentObjects)
+{
+    for (const uint64_t digits : {1, 2, 3, 17, 63, 64, 65, 200, 1000})
+    {
+        const BigInt x = (BigInt(1) << (bigint_base_t_size_bits * digits)) - BigInt(1) - (BigInt(12345) << 100);
+        const BigInt copy = x;
+        EXPECT_EQ(x * copy, x * x);
+        EXPECT_EQ(-x * copy, -(x * x));
+    }
+}
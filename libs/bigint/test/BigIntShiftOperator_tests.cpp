@@ -185,6 +185,22 @@ TEST_F(BigIntShiftOperator_tests, inPlaceShiftRightLongNumber)
     EXPECT_EQ(expected, (big_int).raw_data());
 }
 
+TEST_F(BigIntShiftOperator_tests, inPlaceShiftsByMoreThanOneDigitAreReversible)
+{
+    const BigInt big_int(std::vector<bigint_base_t>{1, 2, 3, 4});
+    const unsigned shift(bigint_base_t_size_bits * 2 + 1);
+
+    BigInt shifted = big_int;
+    shifted <<= shift;
+    EXPECT_EQ(big_int << shift, shifted);
+
+    shifted >>= shift;
+    EXPECT_EQ(big_int, shifted);
+
+    shifted >>= bigint_base_t_size_bits;
+    EXPECT_EQ(big_int >> bigint_base_t_size_bits, shifted);
+}
+
 TEST_F(BigIntShiftOperator_tests, inPlaceShiftRightLongerThanNumber)
 {
     BigInt big_int(921083UL);
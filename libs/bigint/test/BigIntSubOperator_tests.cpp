@@ -220,6 +220,11 @@ TEST_F(BigIntSubOperator_tests, subtractInPlaceMultiple)
         a -= BigInt("-2879837248239049293089023730482394829348209384");
         EXPECT_EQ(a, BigInt("-118104084582677972108144099921243794649573529907"));
     }
+    {
+        BigInt a{"-2879837248239049293089023730482394829348209384"};
+        a -= BigInt("-120983921830917021401233123651726189478921739291");
+        EXPECT_EQ(a, BigInt("118104084582677972108144099921243794649573529907"));
+    }
     {
         BigInt a{"831127295038208856574101364210326099334589529224443748771826709260"};
         a -= BigInt("425174090231226889143651467770346674551599047014956346098441743973532112179");
@@ -3,7 +3,13 @@
 #include <yabil/bigint/BigInt.h>
 #include <yabil/crypto/crypto_export.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <istream>
+#include <mutex>
 #include <ostream>
+#include <span>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -21,15 +27,30 @@ struct PublicKey
 };
 
 /// @brief RSA Private key definition
+/// @details Key with Chinese Remainder Theorem components (\p p, \p q, \p dP, \p dQ, \p qInv) is decrypted with two
+///          exponentiations modulo primes instead of one modulo \p n. Key made of \p d and \p n only is still valid.
 struct PrivateKey
 {
     yabil::bigint::BigInt d;
     yabil::bigint::BigInt n;
+    yabil::bigint::BigInt p{};     ///< First prime factor of \p n
+    yabil::bigint::BigInt q{};     ///< Second prime factor of \p n
+    yabil::bigint::BigInt dP{};    ///< d mod (p - 1)
+    yabil::bigint::BigInt dQ{};    ///< d mod (q - 1)
+    yabil::bigint::BigInt qInv{};  ///< q^(-1) mod p
+
+    /// @brief Check if key contains Chinese Remainder Theorem components.
+    /// @return \p true if key can be used for decryption with Chinese Remainder Theorem
+    bool has_crt_components() const
+    {
+        return !p.is_zero() && !q.is_zero();
+    }
 };
 
 /// @brief Generate RSA public and private keys.
+/// @details Private key contains Chinese Remainder Theorem components.
 /// @param p Prime number
-/// @param q Prime number different than q
+/// @param q Prime number different than p
 /// @return \p std::pair of \p PublicKey and \p PrivateKey
 YABIL_CRYPTO_EXPORT std::pair<PublicKey, PrivateKey> generate_keys(bigint::BigInt p, bigint::BigInt q);
 
@@ -40,12 +61,89 @@ YABIL_CRYPTO_EXPORT std::pair<PublicKey, PrivateKey> generate_keys(bigint::BigIn
 YABIL_CRYPTO_EXPORT yabil::bigint::BigInt encrypt(uint8_t byte, const PublicKey &pub_key);
 
 /// @brief Decrypt single item using RSA private key.
+/// @details With Chinese Remainder Theorem components of the key, message is recovered from exponentiations modulo
+///          \p p and \p q (run concurrently on the thread pool for large keys) combined with Garner's formula.
+///          Exponentiations with private exponents take time independent of the exponent values.
 /// @param encrypted Encrypted item to decrypt
 /// @param private_key RSA private key
 /// @return \p BigInt result of decryption
 YABIL_CRYPTO_EXPORT yabil::bigint::BigInt decrypt(const yabil::bigint::BigInt &encrypted,
                                                   const PrivateKey &private_key);
 
+/// @brief Cached blinding factors for RSA private-key operations.
+/// @details Encrypted item is multiplied by random r before the private-key operation and its result by r^-d after it,
+///          so the operation is performed on a number unrelated to the item. Factors are created with single
+///          private-key operation and squared after every use, which makes blinding almost free. One object can be
+///          shared by many threads.
+class Blinding
+{
+private:
+    yabil::bigint::BigInt n;
+    yabil::bigint::BigInt factor;
+    yabil::bigint::BigInt unblinding_factor;
+    std::mutex factors_mutex;
+
+public:
+    /// @brief Create random blinding factors for given key.
+    /// @param private_key RSA private key
+    YABIL_CRYPTO_EXPORT explicit Blinding(const PrivateKey &private_key);
+
+    /// @brief Get factors for single private-key operation and update cached factors.
+    /// @return Pair of blinding factor r and unblinding factor r^-d modulo n
+    YABIL_CRYPTO_EXPORT std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt> next();
+};
+
+/// @brief Decrypt single item using RSA private key with base blinding.
+/// @param encrypted Encrypted item to decrypt
+/// @param private_key RSA private key
+/// @param blinding Blinding factors created for \p private_key
+/// @return \p BigInt result of decryption
+YABIL_CRYPTO_EXPORT yabil::bigint::BigInt decrypt(const yabil::bigint::BigInt &encrypted, const PrivateKey &private_key,
+                                                  Blinding &blinding);
+
+/// @brief Decrypt many items using RSA private key.
+/// @details Items are decrypted on the thread pool. Montgomery contexts for primes of the key (or for \p n when
+///          the key has no Chinese Remainder Theorem components) are created once and shared by all items.
+/// @param encrypted Encrypted items to decrypt
+/// @param private_key RSA private key
+/// @return Results of decryption in the order of items
+YABIL_CRYPTO_EXPORT std::vector<yabil::bigint::BigInt> decrypt_batch(std::span<const yabil::bigint::BigInt> encrypted,
+                                                                     const PrivateKey &private_key);
+
+/// @brief Decrypt many items using RSA private key with base blinding.
+/// @details Every item gets its own blinding factors taken from \p blinding.
+/// @param encrypted Encrypted items to decrypt
+/// @param private_key RSA private key
+/// @param blinding Blinding factors created for \p private_key
+/// @return Results of decryption in the order of items
+YABIL_CRYPTO_EXPORT std::vector<yabil::bigint::BigInt> decrypt_batch(std::span<const yabil::bigint::BigInt> encrypted,
+                                                                     const PrivateKey &private_key,
+                                                                     Blinding &blinding);
+
+/// @brief Get number of message bytes packed into single block for given modulus.
+/// @details It is the greatest number of bytes, such that every block is lower than \p n.
+/// @param n RSA modulus
+/// @return Number of bytes in block
+YABIL_CRYPTO_EXPORT std::size_t block_size(const yabil::bigint::BigInt &n);
+
+/// @brief Encrypt data using RSA public key, packing \p block_size bytes into each encrypted item.
+/// @details Bytes are packed in little-endian order. The last block is terminated with single byte of value 1
+///          followed by zeros, so the last item contains only this marker when data size is a multiple of block size.
+/// @throws std::invalid_argument when modulus is too small to hold single byte in a block
+/// @param data Bytes to encrypt
+/// @param pub_key RSA Public Key
+/// @return Encrypted blocks
+YABIL_CRYPTO_EXPORT std::vector<yabil::bigint::BigInt> encrypt(std::span<const uint8_t> data,
+                                                               const PublicKey &pub_key);
+
+/// @brief Decrypt data encrypted in blocks using RSA private key.
+/// @throws std::invalid_argument when modulus is too small to hold single byte in a block or blocks are malformed
+/// @param encrypted Encrypted blocks
+/// @param private_key RSA private key
+/// @return Decrypted bytes
+YABIL_CRYPTO_EXPORT std::vector<uint8_t> decrypt(std::span<const yabil::bigint::BigInt> encrypted,
+                                                 const PrivateKey &private_key);
+
 class EncryptionStreamWrapper
 {
 private:
@@ -61,15 +159,17 @@ public:
     {
         std::ostringstream converted_data;
         converted_data << data;
+
+        std::string encrypted_data;
         for (char chr : converted_data.str())
         {
             const auto encrypted = encrypt(chr, pub_key);
             const auto data_size = encrypted.byte_size();
 
-            out.write(reinterpret_cast<const char *>(&data_size), sizeof(data_size));
-            out.write(reinterpret_cast<const char *>(encrypted.raw_data().data()),
-                      static_cast<std::streamsize>(data_size));
+            encrypted_data.append(reinterpret_cast<const char *>(&data_size), sizeof(data_size));
+            encrypted_data.append(reinterpret_cast<const char *>(encrypted.raw_data().data()), data_size);
         }
+        out.write(encrypted_data.data(), static_cast<std::streamsize>(encrypted_data.size()));
         return *this;
     }
 };
@@ -101,7 +201,111 @@ public:
     }
 
 private:
+    std::vector<yabil::bigint::bigint_base_t> raw_data_buffer;
+
     YABIL_CRYPTO_EXPORT char read_single_encoded_item();
 };
 
+/// @brief Default number of blocks encrypted or decrypted at once by block stream wrappers.
+constexpr std::size_t default_stream_batch_blocks = 256;
+
+/// @brief Stream wrapper encrypting written data in blocks, as done by \p encrypt for byte spans.
+/// @details Each block is written as its size in bytes followed by its digits, same as items written by
+///          \p EncryptionStreamWrapper. Highest bit of size of the last block is set. Data is collected into batches
+///          of blocks, which are encrypted in parallel on the thread pool while next batch is filled, and written in
+///          order with single write per batch. The last block is written by \p finish or on destruction.
+class BlockEncryptionStreamWrapper
+{
+private:
+    std::ostream &out;
+    const PublicKey pub_key;
+    const std::size_t bytes_per_block;
+    const std::size_t batch_bytes;
+    std::vector<uint8_t> buffer;
+    std::vector<std::future<std::string>> pending_batch;
+    bool finished = false;
+
+public:
+    /// @throws std::invalid_argument when modulus is too small to hold single byte in a block
+    YABIL_CRYPTO_EXPORT BlockEncryptionStreamWrapper(std::ostream &out, PublicKey pub_key,
+                                                     std::size_t batch_blocks = default_stream_batch_blocks);
+    YABIL_CRYPTO_EXPORT ~BlockEncryptionStreamWrapper();
+
+    BlockEncryptionStreamWrapper(const BlockEncryptionStreamWrapper &) = delete;
+    BlockEncryptionStreamWrapper &operator=(const BlockEncryptionStreamWrapper &) = delete;
+
+    template <typename T>
+    BlockEncryptionStreamWrapper &operator<<(const T &data)
+    {
+        std::ostringstream converted_data;
+        converted_data << data;
+        const auto str = converted_data.str();
+        write(std::span(reinterpret_cast<const uint8_t *>(str.data()), str.size()));
+        return *this;
+    }
+
+    /// @brief Encrypt raw bytes.
+    /// @param data Bytes to encrypt
+    YABIL_CRYPTO_EXPORT void write(std::span<const uint8_t> data);
+
+    /// @brief Write all pending blocks and the last block, no data can be written afterwards.
+    /// @details Called by the destructor, which ignores errors. Call it explicitly to get errors reported.
+    YABIL_CRYPTO_EXPORT void finish();
+
+private:
+    void submit_batch(std::span<const uint8_t> data, bool last);
+    void write_batch(std::vector<std::future<std::string>> batch);
+};
+
+/// @brief Stream wrapper decrypting data written by \p BlockEncryptionStreamWrapper.
+/// @details Blocks are read in batches. Next batch is read and decrypted in parallel on the thread pool while the
+///          current one is consumed. Reading stops after the last block, so data following it is left in the stream.
+///          Reading throws \p std::invalid_argument when stream ends before the last block or contains block longer
+///          than the modulus.
+class BlockDecryptionStreamWrapper
+{
+private:
+    std::istream &in;
+    const PrivateKey private_key;
+    const std::size_t bytes_per_block;
+    const std::size_t batch_blocks;
+    std::vector<uint8_t> buffer;
+    std::size_t position = 0;
+    std::vector<std::future<std::vector<uint8_t>>> pending_batch;
+    bool pending_batch_is_last = false;
+    std::vector<yabil::bigint::bigint_base_t> raw_data_buffer;
+
+public:
+    /// @throws std::invalid_argument when modulus is too small to hold single byte in a block
+    YABIL_CRYPTO_EXPORT BlockDecryptionStreamWrapper(std::istream &in, PrivateKey private_key,
+                                                     std::size_t batch_blocks = default_stream_batch_blocks);
+    YABIL_CRYPTO_EXPORT ~BlockDecryptionStreamWrapper();
+
+    BlockDecryptionStreamWrapper(const BlockDecryptionStreamWrapper &) = delete;
+    BlockDecryptionStreamWrapper &operator=(const BlockDecryptionStreamWrapper &) = delete;
+
+    /// @brief Decrypt all remaining data.
+    /// @return Decrypted data
+    YABIL_CRYPTO_EXPORT std::string read_all();
+
+    template <typename T>
+    BlockDecryptionStreamWrapper &operator>>(T &data)
+    {
+        std::string result;
+        char item = 0;
+        while (read_byte(item) && item != ' ')
+        {
+            result.push_back(item);
+        }
+        std::istringstream in_stream(result);
+        in_stream >> data;
+        return *this;
+    }
+
+private:
+    YABIL_CRYPTO_EXPORT bool read_byte(char &byte);
+    bool read_batch();
+    void submit_batch();
+};
+
 }  // namespace yabil::crypto::rsa
@@ -1,15 +1,32 @@
 #pragma once
 
 #include <yabil/bigint/BigInt.h>
+#include <yabil/crypto/RandomGenerator.h>
 #include <yabil/crypto/crypto_export.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 /// @brief Pseudo-random big integer generation functionalities
 namespace yabil::crypto::random
 {
 
+/// @brief Method of probabilistic primality testing.
+enum class PrimalityMode
+{
+    /// Miller-Rabin test with random bases, number of rounds depends on size of the number, so that probability of
+    /// accepting random composite of at least 100 bits is about 2^-80. Smaller numbers rely on the worst-case bound
+    /// 4^-rounds, which is between 2^-68 and 2^-54. Bounds do not hold for numbers chosen by an adversary.
+    MillerRabin,
+    /// Baillie-PSW test: strong probable prime test to base 2 and strong Lucas probable prime test. No composite
+    /// passing it is known.
+    BailliePSW
+};
+
 /// @brief Generate large pseudo-random integer.
+/// @details Random bits are taken from generator of the current thread, see \p thread_generator.
 /// @param number_of_bits Number of bits to generate
 /// @param top_two Force most-significant bit to value of 1
 /// @param bottom_odd Force least-significant bit to value of 1
@@ -18,15 +35,56 @@ YABIL_CRYPTO_EXPORT yabil::bigint::BigInt random_bigint(uint64_t number_of_bits
                                                         bool bottom_odd = false);
 
 /// @brief Generate large pseudo-random integer.
+/// @details Every number of the range is equally probable, numbers out of the range are rejected and drawn again.
 /// @param min Minimum value to generate
 /// @param max Maximum value to generate
 /// @return Pseudo-random \p BigInt
+/// @throws std::invalid_argument when \p min is greater than \p max
 YABIL_CRYPTO_EXPORT yabil::bigint::BigInt random_bigint(const yabil::bigint::BigInt &min,
                                                         const yabil::bigint::BigInt &max);
 
+/// @brief Generate many large pseudo-random integers at once.
+/// @details Random bits for all numbers are generated with single generator call.
+/// @param numbers Numbers to overwrite with pseudo-random values
+/// @param number_of_bits Number of bits to generate for each number
+YABIL_CRYPTO_EXPORT void fill_random(std::span<yabil::bigint::BigInt> numbers, uint64_t number_of_bits = 64);
+
 /// @brief Generate large random prime number.
 /// @param number_of_bits Number of bits for prime number
 /// @return Pseudo-random prime \p BigInt
 YABIL_CRYPTO_EXPORT yabil::bigint::BigInt random_prime(uint64_t number_of_bits = 1024);
 
+/// @brief Check if number is probably prime.
+/// @details Number is checked against small primes before running the test given by \p mode.
+/// @param number Number to test
+/// @param mode Primality test to use
+/// @return \p false if number is composite and \p true if it is prime with high probability
+YABIL_CRYPTO_EXPORT bool is_probable_prime(const yabil::bigint::BigInt &number,
+                                           PrimalityMode mode = PrimalityMode::MillerRabin);
+
+/// @brief Generate many large random prime numbers.
+/// @param count Number of primes to generate
+/// @param number_of_bits Number of bits for each prime number
+/// @return \p std::vector of pseudo-random prime \p BigInt
+YABIL_CRYPTO_EXPORT std::vector<yabil::bigint::BigInt> random_primes(std::size_t count,
+                                                                     uint64_t number_of_bits = 1024);
+
+namespace parallel
+{
+
+/// @brief Generate large random prime number testing candidates in parallel.
+/// @details Candidates are tested by all threads of the pool, the first thread which finds prime stops the others.
+/// @param number_of_bits Number of bits for prime number
+/// @return Pseudo-random prime \p BigInt
+YABIL_CRYPTO_EXPORT yabil::bigint::BigInt random_prime(uint64_t number_of_bits = 1024);
+
+/// @brief Generate many large random prime numbers testing candidates in parallel.
+/// @param count Number of primes to generate
+/// @param number_of_bits Number of bits for each prime number
+/// @return \p std::vector of pseudo-random prime \p BigInt
+YABIL_CRYPTO_EXPORT std::vector<yabil::bigint::BigInt> random_primes(std::size_t count,
+                                                                     uint64_t number_of_bits = 1024);
+
+}  // namespace parallel
+
 }  // namespace yabil::crypto::random
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <yabil/crypto/crypto_export.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace yabil::crypto::random
+{
+
+/// @brief Source of random bytes used by random number generation functions.
+/// @details Single generator instance is not required to be thread-safe, it is always used by one thread at a time.
+class YABIL_CRYPTO_EXPORT RandomGenerator
+{
+public:
+    virtual ~RandomGenerator() = default;
+
+    /// @brief Fill buffer with random bytes.
+    /// @param buffer Buffer to fill
+    virtual void fill(std::span<uint8_t> buffer) = 0;
+};
+
+/// @brief Cryptographically secure generator based on ChaCha20 stream cipher.
+/// @details Keystream is generated in batches of several blocks at once. Last 32 bytes of every batch are never
+/// returned and become the key for the next batch, so compromise of the generator state does not reveal already
+/// generated bytes. Output depends only on the seed, generators with equal seeds produce equal sequences.
+class ChaCha20Generator : public RandomGenerator
+{
+public:
+    /// Size of the seed (ChaCha20 key) in bytes.
+    static constexpr std::size_t seed_size = 32;
+
+    /// Number of ChaCha20 blocks generated at once.
+    static constexpr std::size_t batch_blocks = 16;
+
+private:
+    static constexpr std::size_t block_size = 64;
+    static constexpr std::size_t batch_size = batch_blocks * block_size;
+    static constexpr std::size_t output_size = batch_size - seed_size;
+
+    std::array<uint32_t, 8> key{};
+    std::array<uint8_t, batch_size> buffer{};
+    std::size_t position = output_size;
+
+public:
+    /// @brief Create generator seeded from \p std::random_device.
+    YABIL_CRYPTO_EXPORT ChaCha20Generator();
+
+    /// @brief Create deterministic generator.
+    /// @param seed Seed used as the first ChaCha20 key
+    YABIL_CRYPTO_EXPORT explicit ChaCha20Generator(const std::array<uint8_t, seed_size> &seed);
+
+    YABIL_CRYPTO_EXPORT ~ChaCha20Generator() override;
+
+    /// @brief Fill buffer with random bytes.
+    /// @param buffer Buffer to fill
+    YABIL_CRYPTO_EXPORT void fill(std::span<uint8_t> buffer) override;
+
+private:
+    void refill();
+};
+
+/// @brief Get generator used by random number generation functions in the current thread.
+/// @details Unless replaced with \p set_thread_generator, every thread uses its own \p ChaCha20Generator seeded from
+/// \p std::random_device on first use. Worker threads of parallel functions always use their own generators.
+/// @return Reference to generator of the current thread
+YABIL_CRYPTO_EXPORT RandomGenerator &thread_generator();
+
+/// @brief Replace generator used in the current thread, e.g. with deterministic generator for reproducible results.
+/// @param generator Generator to use, it must outlive its usage, \p nullptr restores the default generator
+/// @return Previously set generator or \p nullptr if default generator was used
+YABIL_CRYPTO_EXPORT RandomGenerator *set_thread_generator(RandomGenerator *generator);
+
+}  // namespace yabil::crypto::random
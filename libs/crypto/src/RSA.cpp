@@ -2,17 +2,293 @@
 #include <yabil/crypto/RSA.h>
 #include <yabil/crypto/Random.h>
 #include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
+#include <yabil/utils/ThreadPoolSingleton.h>
 
 #include <algorithm>
+#include <bit>
 #include <cstring>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace yabil::crypto::rsa
 {
 
+namespace
+{
+
+// Minimal size of prime factors for which exponentiations modulo p and q are run concurrently
+constexpr std::size_t parallel_crt_min_bytes = 64;
+
+/// Garner's formula: m = m2 + q * (qInv * (m1 - m2) mod p) for m1 = m mod p and m2 = m mod q.
+yabil::bigint::BigInt garner_combine(const yabil::bigint::BigInt &m1, const yabil::bigint::BigInt &m2,
+                                     const PrivateKey &private_key)
+{
+    auto h = ((m1 - m2) * private_key.qInv) % private_key.p;
+    if (h.is_negative())
+    {
+        h += private_key.p;
+    }
+    return m2 + h * private_key.q;
+}
+
+yabil::bigint::BigInt decrypt_crt(const yabil::bigint::BigInt &encrypted, const PrivateKey &private_key)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    if (private_key.q.byte_size() < parallel_crt_min_bytes || thread_pool.is_current_thread_worker())
+    {
+        return garner_combine(yabil::math::pow_consttime(encrypted, private_key.dP, private_key.p),
+                              yabil::math::pow_consttime(encrypted, private_key.dQ, private_key.q), private_key);
+    }
+
+    // Task owns copies of its arguments, so it stays valid even if it outlives this call
+    auto m2 = thread_pool.submit([encrypted, dQ = private_key.dQ, q = private_key.q]()
+                                 { return yabil::math::pow_consttime(encrypted, dQ, q); });
+    std::optional<yabil::bigint::BigInt> m1;
+    try
+    {
+        m1 = yabil::math::pow_consttime(encrypted, private_key.dP, private_key.p);
+    }
+    catch (...)
+    {
+        m2.wait();
+        throw;
+    }
+    return garner_combine(*m1, m2.get(), private_key);
+}
+
+/// Montgomery contexts for moduli of private key, created once and shared by many decryptions.
+class PrivateKeyContexts
+{
+private:
+    const PrivateKey &private_key;
+    std::optional<yabil::math::MontgomeryContext> p_context;
+    std::optional<yabil::math::MontgomeryContext> q_context;
+
+public:
+    explicit PrivateKeyContexts(const PrivateKey &private_key) : private_key(private_key)
+    {
+        if (private_key.has_crt_components())
+        {
+            p_context.emplace(private_key.p);
+            q_context.emplace(private_key.q);
+        }
+        else
+        {
+            p_context.emplace(private_key.n);
+        }
+    }
+
+    yabil::bigint::BigInt decrypt(const yabil::bigint::BigInt &encrypted) const
+    {
+        if (!q_context)
+        {
+            return pow_modulo(*p_context, encrypted, private_key.d);
+        }
+        return garner_combine(pow_modulo(*p_context, encrypted, private_key.dP),
+                              pow_modulo(*q_context, encrypted, private_key.dQ), private_key);
+    }
+
+private:
+    static yabil::bigint::BigInt pow_modulo(const yabil::math::MontgomeryContext &context,
+                                            const yabil::bigint::BigInt &x, const yabil::bigint::BigInt &exponent)
+    {
+        return context.from_montgomery(context.pow_consttime(context.to_montgomery(x), exponent));
+    }
+};
+
+// Byte terminating data in the last block, followed by zeros up to the block end
+constexpr uint8_t block_end_marker = 1;
+
+constexpr std::size_t digit_bytes = sizeof(yabil::bigint::bigint_base_t);
+
+std::size_t checked_block_size(const yabil::bigint::BigInt &n)
+{
+    const auto bytes_per_block = block_size(n);
+    if (bytes_per_block == 0)
+    {
+        throw std::invalid_argument("Modulus is too small for block encryption");
+    }
+    return bytes_per_block;
+}
+
+/// Pack bytes into number in little-endian order.
+yabil::bigint::BigInt pack_block(std::span<const uint8_t> bytes)
+{
+    std::vector<yabil::bigint::bigint_base_t> digits((bytes.size() + digit_bytes - 1) / digit_bytes);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+    {
+        digits[i / digit_bytes] |= static_cast<yabil::bigint::bigint_base_t>(bytes[i]) << (8 * (i % digit_bytes));
+    }
+    return yabil::bigint::BigInt(std::move(digits));
+}
+
+/// Append bytes_per_block bytes of block in little-endian order to result.
+void unpack_block(const yabil::bigint::BigInt &block, std::size_t bytes_per_block, std::vector<uint8_t> &result)
+{
+    const auto &digits = block.raw_data();
+    for (std::size_t i = bytes_per_block; i < digits.size() * digit_bytes; ++i)
+    {
+        if ((digits[i / digit_bytes] >> (8 * (i % digit_bytes))) & 0xFF)
+        {
+            throw std::invalid_argument("Decrypted block does not fit into block size");
+        }
+    }
+
+    for (std::size_t i = 0; i < bytes_per_block; ++i)
+    {
+        const auto digit = i / digit_bytes < digits.size() ? digits[i / digit_bytes] : 0;
+        result.push_back(static_cast<uint8_t>(digit >> (8 * (i % digit_bytes))));
+    }
+}
+
+/// Remove end marker and padding of the last block, which starts at last_block_begin.
+void remove_block_end_marker(std::vector<uint8_t> &data, std::size_t last_block_begin)
+{
+    while (data.size() > last_block_begin && data.back() == 0)
+    {
+        data.pop_back();
+    }
+
+    if (data.size() == last_block_begin || data.back() != block_end_marker)
+    {
+        throw std::invalid_argument("Last block does not contain end marker");
+    }
+    data.pop_back();
+}
+
+yabil::bigint::BigInt encrypt_block(std::span<const uint8_t> bytes, const PublicKey &pub_key)
+{
+    return yabil::math::pow(pack_block(bytes), pub_key.e, pub_key.n);
+}
+
+/// Encrypt the last block, consisting of remaining data and end marker.
+yabil::bigint::BigInt encrypt_last_block(std::span<const uint8_t> bytes, const PublicKey &pub_key)
+{
+    std::vector<uint8_t> last_block(bytes.begin(), bytes.end());
+    last_block.push_back(block_end_marker);
+    return encrypt_block(last_block, pub_key);
+}
+
+// Bit of item size marking the last item of block stream
+constexpr uint64_t last_item_flag = uint64_t{1} << 63;
+
+/// Append item as its size in bytes followed by its digits.
+void append_item(std::string &out, const yabil::bigint::BigInt &item, bool last = false)
+{
+    const uint64_t data_size = item.byte_size();
+    const auto size_field = last ? data_size | last_item_flag : data_size;
+    out.append(reinterpret_cast<const char *>(&size_field), sizeof(size_field));
+    out.append(reinterpret_cast<const char *>(item.raw_data().data()), data_size);
+}
+
+/// Maximal size in bytes of item encrypted with modulus n.
+std::size_t max_item_size(const yabil::bigint::BigInt &n)
+{
+    return n.raw_data().size() * digit_bytes;
+}
+
+/// Read item written by append_item using given buffer for its digits, return false if there are no more items.
+/// Items longer than max_size are rejected before their digits are read.
+bool read_item(std::istream &in, std::size_t max_size, std::vector<yabil::bigint::bigint_base_t> &raw_data_buffer,
+               yabil::bigint::BigInt &item, bool &last)
+{
+    uint64_t data_size = 0;
+    if (!in.read(reinterpret_cast<char *>(&data_size), sizeof(data_size)))
+    {
+        return false;
+    }
+    last = (data_size & last_item_flag) != 0;
+    data_size &= ~last_item_flag;
+
+    if (data_size > max_size)
+    {
+        throw std::invalid_argument("Encrypted item is longer than modulus");
+    }
+
+    raw_data_buffer.assign((data_size + digit_bytes - 1) / digit_bytes, 0);
+    if (!in.read(reinterpret_cast<char *>(raw_data_buffer.data()), static_cast<std::streamsize>(data_size)))
+    {
+        throw std::invalid_argument("Unexpected end of encrypted stream");
+    }
+    item = yabil::bigint::BigInt(std::span<const yabil::bigint::bigint_base_t>(raw_data_buffer));
+    return true;
+}
+
+bool read_item(std::istream &in, std::size_t max_size, std::vector<yabil::bigint::bigint_base_t> &raw_data_buffer,
+               yabil::bigint::BigInt &item)
+{
+    bool last = false;
+    return read_item(in, max_size, raw_data_buffer, item, last);
+}
+
+/// Run chunk_function(begin, end) for chunks of [0, count) on the thread pool. When called from a worker thread,
+/// whole range is computed on the calling thread when result is requested.
+template <typename ChunkFunction>
+auto submit_chunks(std::size_t count, ChunkFunction chunk_function)
+{
+    using ResultType = std::invoke_result_t<ChunkFunction, std::size_t, std::size_t>;
+    std::vector<std::future<ResultType>> results;
+
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    if (thread_pool.is_current_thread_worker())
+    {
+        results.push_back(std::async(std::launch::deferred, chunk_function, std::size_t{0}, count));
+        return results;
+    }
+
+    const auto chunks = std::max<std::size_t>(std::min(thread_pool.thread_count(), count), 1);
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        const auto begin = i * count / chunks;
+        const auto end = (i + 1) * count / chunks;
+        results.push_back(thread_pool.submit([chunk_function, begin, end]() { return chunk_function(begin, end); }));
+    }
+    return results;
+}
+
+/// Compute decrypt_item(i) for all items on the thread pool.
+template <typename DecryptFunction>
+std::vector<yabil::bigint::BigInt> decrypt_items(std::size_t count, const DecryptFunction &decrypt_item)
+{
+    std::vector<yabil::bigint::BigInt> result(count);
+    auto chunks = submit_chunks(count,
+                                [&result, &decrypt_item](std::size_t begin, std::size_t end)
+                                {
+                                    for (auto i = begin; i < end; ++i)
+                                    {
+                                        result[i] = decrypt_item(i);
+                                    }
+                                });
+
+    // Every chunk refers to the result, so all of them must finish before any exception is rethrown
+    for (auto &chunk : chunks)
+    {
+        chunk.wait();
+    }
+    for (auto &chunk : chunks)
+    {
+        chunk.get();
+    }
+    return result;
+}
+
+}  // namespace
+
 std::pair<PublicKey, PrivateKey> generate_keys(bigint::BigInt p, bigint::BigInt q)
 {
     const auto n = p * q;
-    const auto phi = (--p) * (--q);
+    const auto p_minus_one = p - yabil::bigint::BigInt(1);
+    const auto q_minus_one = q - yabil::bigint::BigInt(1);
+    const auto phi = p_minus_one * q_minus_one;
 
     yabil::bigint::BigInt e(2);
     while (e < phi && yabil::math::gcd(e, phi) != yabil::bigint::BigInt(1))
@@ -20,7 +296,8 @@ std::pair<PublicKey, PrivateKey> generate_keys(bigint::BigInt p, bigint::BigInt
         ++e;
     }
     const auto d = yabil::math::mod_inverse(e, phi);
-    return {{e, n}, {d, n}};
+    auto q_inverse = yabil::math::mod_inverse(q, p);
+    return {{e, n}, {d, n, std::move(p), std::move(q), d % p_minus_one, d % q_minus_one, std::move(q_inverse)}};
 }
 
 yabil::bigint::BigInt encrypt(uint8_t byte, const PublicKey &pub_key)
@@ -30,7 +307,111 @@ yabil::bigint::BigInt encrypt(uint8_t byte, const PublicKey &pub_key)
 
 yabil::bigint::BigInt decrypt(const yabil::bigint::BigInt &encrypted, const PrivateKey &private_key)
 {
-    return yabil::math::pow(encrypted, private_key.d, private_key.n);
+    if (private_key.has_crt_components())
+    {
+        return decrypt_crt(encrypted, private_key);
+    }
+    return yabil::math::pow_consttime(encrypted, private_key.d, private_key.n);
+}
+
+Blinding::Blinding(const PrivateKey &private_key) : n(private_key.n)
+{
+    do
+    {
+        factor = random::random_bigint(yabil::bigint::BigInt(2), n - yabil::bigint::BigInt(1));
+    } while (yabil::math::gcd(factor, n) != yabil::bigint::BigInt(1));
+    unblinding_factor = rsa::decrypt(yabil::math::mod_inverse(factor, n), private_key);
+}
+
+std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt> Blinding::next()
+{
+    const std::lock_guard lock(factors_mutex);
+    auto factors = std::make_pair(factor, unblinding_factor);
+
+    // (r^2)^-d = (r^-d)^2, so squared factors are valid pair as well
+    factor = (factor * factor) % n;
+    unblinding_factor = (unblinding_factor * unblinding_factor) % n;
+    return factors;
+}
+
+yabil::bigint::BigInt decrypt(const yabil::bigint::BigInt &encrypted, const PrivateKey &private_key,
+                              Blinding &blinding)
+{
+    const auto [factor, unblinding_factor] = blinding.next();
+    return (decrypt((encrypted * factor) % private_key.n, private_key) * unblinding_factor) % private_key.n;
+}
+
+std::vector<yabil::bigint::BigInt> decrypt_batch(std::span<const yabil::bigint::BigInt> encrypted,
+                                                 const PrivateKey &private_key)
+{
+    const PrivateKeyContexts contexts(private_key);
+    return decrypt_items(encrypted.size(), [&](std::size_t i) { return contexts.decrypt(encrypted[i]); });
+}
+
+std::vector<yabil::bigint::BigInt> decrypt_batch(std::span<const yabil::bigint::BigInt> encrypted,
+                                                 const PrivateKey &private_key, Blinding &blinding)
+{
+    std::vector<std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt>> factors;
+    factors.reserve(encrypted.size());
+    for (std::size_t i = 0; i < encrypted.size(); ++i)
+    {
+        factors.push_back(blinding.next());
+    }
+
+    const PrivateKeyContexts contexts(private_key);
+    const auto &n = private_key.n;
+    return decrypt_items(encrypted.size(),
+                         [&](std::size_t i)
+                         {
+                             const auto &[factor, unblinding_factor] = factors[i];
+                             return (contexts.decrypt((encrypted[i] * factor) % n) * unblinding_factor) % n;
+                         });
+}
+
+std::size_t block_size(const yabil::bigint::BigInt &n)
+{
+    if (n.is_negative() || n.is_zero())
+    {
+        return 0;
+    }
+
+    const auto n_bits = n.byte_size() * 8 - static_cast<std::size_t>(std::countl_zero(n.raw_data().back()));
+    return (n_bits - 1) / 8;
+}
+
+std::vector<yabil::bigint::BigInt> encrypt(std::span<const uint8_t> data, const PublicKey &pub_key)
+{
+    const auto bytes_per_block = checked_block_size(pub_key.n);
+
+    std::vector<yabil::bigint::BigInt> result;
+    result.reserve(data.size() / bytes_per_block + 1);
+
+    std::size_t offset = 0;
+    for (; data.size() - offset >= bytes_per_block; offset += bytes_per_block)
+    {
+        result.push_back(encrypt_block(data.subspan(offset, bytes_per_block), pub_key));
+    }
+    result.push_back(encrypt_last_block(data.subspan(offset), pub_key));
+    return result;
+}
+
+std::vector<uint8_t> decrypt(std::span<const yabil::bigint::BigInt> encrypted, const PrivateKey &private_key)
+{
+    const auto bytes_per_block = checked_block_size(private_key.n);
+    if (encrypted.empty())
+    {
+        throw std::invalid_argument("Encrypted data must contain at least one block");
+    }
+
+    std::vector<uint8_t> result;
+    result.reserve(encrypted.size() * bytes_per_block);
+    for (const auto &block : decrypt_batch(encrypted, private_key))
+    {
+        unpack_block(block, bytes_per_block, result);
+    }
+
+    remove_block_end_marker(result, result.size() - bytes_per_block);
+    return result;
 }
 
 EncryptionStreamWrapper::EncryptionStreamWrapper(std::ostream &out, const PublicKey &pub_key)
@@ -65,13 +446,228 @@ std::string DecryptionStreamWrapper::read_all()
 
 char DecryptionStreamWrapper::read_single_encoded_item()
 {
-    uint64_t encrypted_item_size = 0;
-    in.read(reinterpret_cast<char *>(&encrypted_item_size), sizeof(uint64_t));
-    std::vector<yabil::bigint::bigint_base_t> raw_data_buffer(encrypted_item_size);
+    yabil::bigint::BigInt encrypted;
+    if (!read_item(in, max_item_size(private_key.n), raw_data_buffer, encrypted))
+    {
+        return '\0';
+    }
+    return static_cast<char>(decrypt(encrypted, private_key).to_int());
+}
+
+BlockEncryptionStreamWrapper::BlockEncryptionStreamWrapper(std::ostream &out, PublicKey pub_key,
+                                                           std::size_t batch_blocks)
+    : out(out),
+      pub_key(std::move(pub_key)),
+      bytes_per_block(checked_block_size(this->pub_key.n)),
+      batch_bytes(bytes_per_block * std::max<std::size_t>(batch_blocks, 1))
+{
+}
+
+BlockEncryptionStreamWrapper::~BlockEncryptionStreamWrapper()
+{
+    try
+    {
+        finish();
+    }
+    catch (...)
+    {
+        // Errors can only be reported by explicit call to finish()
+    }
+
+    // Pending tasks refer to this wrapper
+    for (auto &chunk : pending_batch)
+    {
+        chunk.wait();
+    }
+}
+
+void BlockEncryptionStreamWrapper::write(std::span<const uint8_t> data)
+{
+    if (finished)
+    {
+        throw std::runtime_error("Cannot write to finished encryption stream");
+    }
+
+    buffer.insert(buffer.end(), data.begin(), data.end());
+
+    std::size_t offset = 0;
+    for (; buffer.size() - offset >= batch_bytes; offset += batch_bytes)
+    {
+        submit_batch(std::span(buffer).subspan(offset, batch_bytes), false);
+    }
+    buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+void BlockEncryptionStreamWrapper::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    finished = true;
+    submit_batch(buffer, true);
+    buffer.clear();
+    write_batch(std::exchange(pending_batch, {}));
+}
+
+void BlockEncryptionStreamWrapper::submit_batch(std::span<const uint8_t> data, bool last)
+{
+    const auto batch = std::make_shared<const std::vector<uint8_t>>(data.begin(), data.end());
+    const auto full_blocks = batch->size() / bytes_per_block;
+
+    auto encrypted_batch = submit_chunks(full_blocks + (last ? 1 : 0),
+                                         [this, batch, full_blocks](std::size_t begin, std::size_t end)
+                                         {
+                                             std::string encrypted;
+                                             for (auto i = begin; i < end; ++i)
+                                             {
+                                                 const auto block = std::span(*batch).subspan(i * bytes_per_block);
+                                                 if (i < full_blocks)
+                                                 {
+                                                     append_item(encrypted,
+                                                                 encrypt_block(block.first(bytes_per_block), pub_key));
+                                                 }
+                                                 else
+                                                 {
+                                                     append_item(encrypted, encrypt_last_block(block, pub_key), true);
+                                                 }
+                                             }
+                                             return encrypted;
+                                         });
+
+    // Previous batch is written while the new one is encrypted
+    write_batch(std::exchange(pending_batch, std::move(encrypted_batch)));
+}
+
+void BlockEncryptionStreamWrapper::write_batch(std::vector<std::future<std::string>> batch)
+{
+    // All chunks are finished before any exception leaves, tasks refer to this wrapper
+    for (auto &chunk : batch)
+    {
+        chunk.wait();
+    }
+
+    std::string encrypted;
+    for (auto &chunk : batch)
+    {
+        encrypted += chunk.get();
+    }
+    out.write(encrypted.data(), static_cast<std::streamsize>(encrypted.size()));
+}
+
+BlockDecryptionStreamWrapper::BlockDecryptionStreamWrapper(std::istream &in, PrivateKey private_key,
+                                                           std::size_t batch_blocks)
+    : in(in),
+      private_key(std::move(private_key)),
+      bytes_per_block(checked_block_size(this->private_key.n)),
+      batch_blocks(std::max<std::size_t>(batch_blocks, 1))
+{
+}
+
+BlockDecryptionStreamWrapper::~BlockDecryptionStreamWrapper()
+{
+    // Pending tasks refer to the private key
+    for (auto &chunk : pending_batch)
+    {
+        chunk.wait();
+    }
+}
+
+std::string BlockDecryptionStreamWrapper::read_all()
+{
+    std::string result(buffer.begin() + static_cast<std::ptrdiff_t>(position), buffer.end());
+    while (read_batch())
+    {
+        result.append(buffer.begin(), buffer.end());
+    }
+    position = buffer.size();
+    return result;
+}
+
+bool BlockDecryptionStreamWrapper::read_byte(char &byte)
+{
+    while (position == buffer.size())
+    {
+        if (!read_batch())
+        {
+            return false;
+        }
+    }
+
+    byte = static_cast<char>(buffer[position++]);
+    return true;
+}
+
+bool BlockDecryptionStreamWrapper::read_batch()
+{
+    if (pending_batch.empty() && !pending_batch_is_last)
+    {
+        submit_batch();
+    }
+
+    if (pending_batch.empty())
+    {
+        return false;
+    }
+
+    // All chunks are finished before any exception leaves, tasks refer to the private key
+    auto batch = std::exchange(pending_batch, {});
+    for (auto &chunk : batch)
+    {
+        chunk.wait();
+    }
+
+    buffer.clear();
+    position = 0;
+    for (auto &chunk : batch)
+    {
+        const auto decrypted = chunk.get();
+        buffer.insert(buffer.end(), decrypted.begin(), decrypted.end());
+    }
+
+    if (pending_batch_is_last)
+    {
+        remove_block_end_marker(buffer, buffer.size() - bytes_per_block);
+    }
+    else
+    {
+        // Next batch is decrypted while the current one is consumed
+        submit_batch();
+    }
+    return true;
+}
+
+void BlockDecryptionStreamWrapper::submit_batch()
+{
+    auto batch = std::make_shared<std::vector<yabil::bigint::BigInt>>();
+    batch->reserve(batch_blocks);
+
+    // Reading stops after the last item, data following it is left in the stream
+    const auto max_size = max_item_size(private_key.n);
+    yabil::bigint::BigInt item;
+    while (batch->size() < batch_blocks && !pending_batch_is_last)
+    {
+        if (!read_item(in, max_size, raw_data_buffer, item, pending_batch_is_last))
+        {
+            throw std::invalid_argument("Encrypted stream ends without its last block");
+        }
+        batch->push_back(std::move(item));
+    }
 
-    in.read(reinterpret_cast<char *>(raw_data_buffer.data()), static_cast<std::streamsize>(encrypted_item_size));
-    const auto decrypted = decrypt(yabil::bigint::BigInt(std::move(raw_data_buffer)), private_key);
-    return static_cast<char>(decrypted.to_int());
+    pending_batch = submit_chunks(batch->size(),
+                                  [this, batch = std::shared_ptr<const std::vector<yabil::bigint::BigInt>>(batch)](
+                                      std::size_t begin, std::size_t end)
+                                  {
+                                      const PrivateKeyContexts contexts(private_key);
+                                      std::vector<uint8_t> decrypted;
+                                      decrypted.reserve((end - begin) * bytes_per_block);
+                                      for (auto i = begin; i < end; ++i)
+                                      {
+                                          unpack_block(contexts.decrypt((*batch)[i]), bytes_per_block, decrypted);
+                                      }
+                                      return decrypted;
+                                  });
 }
 
 }  // namespace yabil::crypto::rsa
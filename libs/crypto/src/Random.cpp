@@ -1,11 +1,20 @@
 #include <yabil/bigint/Parallel.h>
 #include <yabil/crypto/Random.h>
 #include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
+#include <yabil/math/ProductTree.h>
+#include <yabil/utils/ThreadPoolSingleton.h>
 
+#include <algorithm>
+#include <atomic>
 #include <bit>
 #include <cmath>
 #include <cstring>
-#include <random>
+#include <future>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -18,115 +27,483 @@ namespace yabil::crypto::random
 namespace
 {
 
-int trial_divisions(uint64_t bits)
+constexpr std::size_t digit_bits = bigint::bigint_base_t_size_bits;
+
+std::size_t digits_count(uint64_t number_of_bits)
+{
+    return static_cast<std::size_t>((number_of_bits + digit_bits - 1) / digit_bits);
+}
+
+/// Clear bits of the last digit above number_of_bits.
+void mask_top_digit(std::span<yabil::bigint::bigint_base_t> digits, uint64_t number_of_bits)
+{
+    if (const auto remaining_bits = number_of_bits % digit_bits; remaining_bits != 0 && !digits.empty())
+    {
+        digits.back() >>= digit_bits - remaining_bits;
+    }
+}
+
+/// Fill digits with random bits from generator of the current thread.
+void fill_random_digits(std::span<yabil::bigint::bigint_base_t> digits)
+{
+    thread_generator().fill(std::span(reinterpret_cast<uint8_t *>(digits.data()), digits.size_bytes()));
+}
+
+// Number of consecutive odd candidates sieved at once
+constexpr std::size_t sieve_interval_size = 2048;
+
+int sieving_primes_count(uint64_t bits)
 {
     if (bits <= 512)
-        return 64;
+        return 512;
     else if (bits <= 1024)
-        return 128;
-    else if (bits <= 2048)
-        return 384;
-    else if (bits <= 4096)
         return 1024;
     return 2048;
 }
 
-yabil::bigint::BigInt probable_prime(uint64_t number_of_bits)
+/// Odd primes used for sieving, packed into groups with products fitting into 64 bits.
+/// Remainders modulo all group products are computed at once with remainder tree.
+struct SievingPrimes
+{
+    std::vector<std::vector<uint64_t>> groups;
+    yabil::math::ProductTree products_tree;
+};
+
+SievingPrimes make_sieving_primes(int sieving_primes_count)
+{
+    std::vector<std::vector<uint64_t>> groups;
+    std::vector<yabil::bigint::BigInt> products;
+    uint64_t product = 1;
+
+    for (int i = 1; i < sieving_primes_count; ++i)
+    {
+        const auto prime = static_cast<uint64_t>(primes()[i]);
+        if (groups.empty() || product > std::numeric_limits<uint64_t>::max() / prime)
+        {
+            if (!groups.empty()) products.emplace_back(product);
+            groups.emplace_back();
+            product = 1;
+        }
+        groups.back().push_back(prime);
+        product *= prime;
+    }
+    products.emplace_back(product);
+
+    return {std::move(groups), yabil::math::ProductTree(products)};
+}
+
+const SievingPrimes &sieving_primes(uint64_t number_of_bits)
 {
-    int trial_division_count = trial_divisions(number_of_bits);
+    static std::mutex sieving_primes_mutex;
+    static std::map<int, SievingPrimes> sieving_primes_cache;
 
-    while (true)
+    const int count = sieving_primes_count(number_of_bits);
+    const std::lock_guard lock(sieving_primes_mutex);
+
+    auto cached = sieving_primes_cache.find(count);
+    if (cached == sieving_primes_cache.end())
+    {
+        cached = sieving_primes_cache.emplace(count, make_sieving_primes(count)).first;
+    }
+    return cached->second;
+}
+
+/// Incremental search for prime candidates. Residues of random odd start modulo small primes are computed once,
+/// then intervals of consecutive odd numbers start + 2k are sieved with them and residues are moved to the next
+/// interval with word arithmetic. Only numbers without small divisors are returned.
+class PrimeCandidateSieve
+{
+private:
+    const uint64_t number_of_bits;
+    const SievingPrimes &sieving;
+    yabil::bigint::BigInt start;
+    std::vector<uint64_t> residues;
+    std::vector<bool> composite;
+    std::size_t position = 0;
+
+public:
+    explicit PrimeCandidateSieve(uint64_t number_of_bits)
+        : number_of_bits(number_of_bits),
+          sieving(sieving_primes(number_of_bits))
     {
-        yabil::bigint::BigInt prime_candidate = random_bigint(number_of_bits, true, true);
-        bool good_candidate = true;
+        restart();
+    }
 
-        for (int i = 1; i < trial_division_count; ++i)
+    yabil::bigint::BigInt next()
+    {
+        while (true)
         {
-            const auto mod = prime_candidate % primes()[i];
-            if (mod == 0)
+            for (; position < composite.size(); ++position)
             {
-                good_candidate = prime_candidate.is_uint64()
-                                     ? (prime_candidate.to_uint() == static_cast<uint64_t>(primes()[i]))
-                                     : false;
-                break;
+                if (!composite[position])
+                {
+                    return start + yabil::bigint::BigInt(2 * position++);
+                }
             }
+            next_interval();
         }
+    }
 
-        if (good_candidate)
+    /// Continue search from new random start.
+    void restart()
+    {
+        start = random_bigint(number_of_bits, true, true);
+        residues.clear();
+
+        const auto remainders = sieving.products_tree.remainder_tree(start);
+        for (std::size_t i = 0; i < remainders.size(); ++i)
         {
-            return prime_candidate;
+            const uint64_t remainder = remainders[i].to_uint();
+            for (const auto prime : sieving.groups[i])
+            {
+                residues.push_back(remainder % prime);
+            }
+        }
+        sieve();
+    }
+
+private:
+    void next_interval()
+    {
+        start += yabil::bigint::BigInt(2 * sieve_interval_size);
+
+        std::size_t i = 0;
+        for (const auto &group : sieving.groups)
+        {
+            for (const auto prime : group)
+            {
+                residues[i] = (residues[i] + 2 * sieve_interval_size) % prime;
+                ++i;
+            }
         }
+        sieve();
     }
+
+    /// Mark k for which start + 2k has small divisor, start + 2k = 0 (mod p) for k = -start / 2 (mod p).
+    void sieve()
+    {
+        const auto end = (yabil::bigint::BigInt(1) << number_of_bits) - start;
+        if (end.is_negative() || end.is_zero())
+        {
+            restart();
+            return;
+        }
+
+        // Interval is cut at the end of number_of_bits range
+        const std::size_t size = end.is_uint64() && end.to_uint() < 2 * sieve_interval_size
+                                     ? static_cast<std::size_t>((end.to_uint() + 1) / 2)
+                                     : sieve_interval_size;
+        composite.assign(size, false);
+        position = 0;
+
+        std::size_t i = 0;
+        for (const auto &group : sieving.groups)
+        {
+            for (const auto prime : group)
+            {
+                const auto inverse_of_two = (prime + 1) / 2;
+                auto k = ((prime - residues[i]) % prime) * inverse_of_two % prime;
+
+                // Small prime itself is not composite
+                if (start.is_uint64() && start.to_uint() + 2 * k == prime)
+                {
+                    k += prime;
+                }
+
+                for (; k < size; k += prime)
+                {
+                    composite[k] = true;
+                }
+                ++i;
+            }
+        }
+    }
+};
+
+/// Number of Miller-Rabin rounds with random bases (same table as in OpenSSL). For random candidates of at least 100
+/// bits probability of accepting composite is about 2^-80 (Damgard, Landrock, Pomerance bounds, HAC table 4.4), for
+/// sizes from 476 to 1344 bits it is between 2^-80 and 2^-112. Below 100 bits only the worst-case bound 4^-rounds is
+/// relied on: 2^-68 for 34 rounds below 55 bits and 2^-54 for 27 rounds above.
+int miller_rabin_rounds(uint64_t bits)
+{
+    if (bits >= 3747)
+        return 3;
+    else if (bits >= 1345)
+        return 4;
+    else if (bits >= 476)
+        return 5;
+    else if (bits >= 400)
+        return 6;
+    else if (bits >= 347)
+        return 7;
+    else if (bits >= 308)
+        return 8;
+    else if (bits >= 55)
+        return 27;
+    return 34;
 }
 
-bool miller_rabin_round(const yabil::bigint::BigInt &prime_candidate,
-                        const yabil::bigint::BigInt &prime_candidate_minus_one,
-                        const yabil::bigint::BigInt &odd_component, int two_power_divisor)
+/// Odd number n > 3 with n - 1 = odd_component * 2^two_power_divisor and its Montgomery context.
+struct PrimalityTestContext
 {
-    const yabil::bigint::BigInt round_tester =
-        random_bigint(yabil::bigint::BigInt(2), prime_candidate - yabil::bigint::BigInt(2));
+    yabil::math::MontgomeryContext context;
+    yabil::bigint::BigInt minus_one;
+    yabil::bigint::BigInt odd_component;
+    uint64_t two_power_divisor = 0;
+
+    explicit PrimalityTestContext(const yabil::bigint::BigInt &n) : context(n)
+    {
+        const auto n_minus_one = n - yabil::bigint::BigInt(1);
+        while (!n_minus_one.get_bit(two_power_divisor))
+        {
+            ++two_power_divisor;
+        }
+        odd_component = n_minus_one >> two_power_divisor;
+        minus_one = context.to_montgomery(n_minus_one);
+    }
+};
 
-    yabil::bigint::BigInt z = yabil::math::pow(round_tester, odd_component, prime_candidate);
-    if (z == yabil::bigint::BigInt(1) || z == prime_candidate_minus_one)
+/// Strong probable prime test to given base (single Miller-Rabin round).
+bool is_strong_probable_prime(const PrimalityTestContext &test, const yabil::bigint::BigInt &base)
+{
+    const auto &context = test.context;
+    auto z = context.pow(context.to_montgomery(base), test.odd_component);
+    if (z == context.one() || z == test.minus_one)
     {
         return true;
     }
 
-    for (int j = 1; j < two_power_divisor; ++j)
+    for (uint64_t j = 1; j < test.two_power_divisor; ++j)
     {
-        z = yabil::math::pow(z, bigint::BigInt(2), prime_candidate);
-        if (z == bigint::BigInt(1)) return false;
-        if (z == prime_candidate_minus_one) return true;
+        z = context.square(z);
+        if (z == context.one()) return false;
+        if (z == test.minus_one) return true;
     }
 
     return false;
 }
 
-bool miller_rabin_test(const yabil::bigint::BigInt &prime_candidate)
+/// Miller-Rabin test with random bases, which gives up (returning false) as soon as stop flag is set.
+bool miller_rabin_test(const yabil::bigint::BigInt &prime_candidate, const std::atomic<bool> *stop = nullptr)
 {
-    const yabil::bigint::BigInt prime_candidate_minus_one = prime_candidate - yabil::bigint::BigInt(1);
-    int two_power_divisor = 1;
-    while (!prime_candidate_minus_one.get_bit(two_power_divisor))
+    const PrimalityTestContext test(prime_candidate);
+    const auto max_base = prime_candidate - yabil::bigint::BigInt(2);
+    const int rounds = miller_rabin_rounds(static_cast<uint64_t>(yabil::math::log2_int(prime_candidate)) + 1);
+
+    for (int i = 0; i < rounds; ++i)
     {
-        ++two_power_divisor;
+        if (stop && stop->load(std::memory_order_relaxed)) return false;
+        if (!is_strong_probable_prime(test, random_bigint(yabil::bigint::BigInt(2), max_base))) return false;
     }
 
-    const yabil::bigint::BigInt odd_component = prime_candidate_minus_one >> two_power_divisor;
-    constexpr int number_of_rabin_trials = 64;
+    return true;
+}
+
+yabil::bigint::BigInt add_mod(yabil::bigint::BigInt a, const yabil::bigint::BigInt &b, const yabil::bigint::BigInt &n)
+{
+    a += b;
+    return a >= n ? a - n : a;
+}
 
-    for (int i = 0; i < number_of_rabin_trials; ++i)
+yabil::bigint::BigInt sub_mod(yabil::bigint::BigInt a, const yabil::bigint::BigInt &b, const yabil::bigint::BigInt &n)
+{
+    a -= b;
+    return a.is_negative() ? a + n : a;
+}
+
+/// x / 2 (mod n) for odd n, the same in Montgomery form.
+yabil::bigint::BigInt half_mod(yabil::bigint::BigInt x, const yabil::bigint::BigInt &n)
+{
+    if (!x.is_even())
+    {
+        x += n;
+    }
+    return x >> 1;
+}
+
+/// Strong Lucas probable prime test with parameters chosen by Selfridge's method A: D is the first of
+/// 5, -7, 9, -11, ... with Jacobi symbol (D | n) = -1, P = 1 and Q = (1 - D) / 4. For n + 1 = d * 2^s it checks
+/// whether U_d = 0 or V_(d * 2^r) = 0 (mod n) for some 0 <= r < s. n must be odd, greater than 3.
+bool is_strong_lucas_probable_prime(const yabil::bigint::BigInt &n)
+{
+    // Selfridge's sequence never finds D for perfect squares
+    constexpr int square_check_attempt = 8;
+
+    int64_t d_value = 5;
+    for (int attempt = 0;; ++attempt, d_value = d_value > 0 ? -(d_value + 2) : -d_value + 2)
     {
-        if (!miller_rabin_round(prime_candidate, prime_candidate_minus_one, odd_component, two_power_divisor))
+        const int symbol = yabil::math::jacobi(yabil::bigint::BigInt(d_value), n);
+        if (symbol == -1)
+        {
+            break;
+        }
+        if (symbol == 0 && n != yabil::bigint::BigInt(d_value > 0 ? d_value : -d_value))
+        {
             return false;
+        }
+        if (attempt == square_check_attempt)
+        {
+            const auto root = yabil::math::sqrt(n);
+            if (root * root == n)
+            {
+                return false;
+            }
+        }
     }
 
-    return true;
+    const yabil::math::MontgomeryContext context(n);
+    const auto to_context = [&](int64_t x)
+    {
+        auto reduced = yabil::bigint::BigInt(x) % n;
+        return context.to_montgomery(reduced.is_negative() ? reduced + n : reduced);
+    };
+    const auto d = to_context(d_value);
+    const auto q = to_context((1 - d_value) / 4);
+
+    const auto n_plus_one = n + yabil::bigint::BigInt(1);
+    uint64_t s = 0;
+    while (!n_plus_one.get_bit(s))
+    {
+        ++s;
+    }
+    const auto odd_component = n_plus_one >> s;
+
+    // U_1 = 1, V_1 = P = 1
+    auto u = context.one();
+    auto v = context.one();
+    auto q_power = q;
+    for (auto bit = static_cast<int64_t>(yabil::math::log2_int(odd_component)) - 1; bit >= 0; --bit)
+    {
+        // U_2k = U_k * V_k, V_2k = V_k^2 - 2Q^k
+        u = context.multiply(u, v);
+        v = sub_mod(context.square(v), add_mod(q_power, q_power, n), n);
+        q_power = context.square(q_power);
+
+        if (odd_component.get_bit(static_cast<uint64_t>(bit)))
+        {
+            // U_(k+1) = (P * U_k + V_k) / 2, V_(k+1) = (D * U_k + P * V_k) / 2
+            auto next_u = half_mod(add_mod(u, v, n), n);
+            v = half_mod(add_mod(context.multiply(d, u), v, n), n);
+            u = std::move(next_u);
+            q_power = context.multiply(q_power, q);
+        }
+    }
+
+    if (u.is_zero() || v.is_zero())
+    {
+        return true;
+    }
+
+    for (uint64_t r = 1; r < s; ++r)
+    {
+        v = sub_mod(context.square(v), add_mod(q_power, q_power, n), n);
+        if (v.is_zero())
+        {
+            return true;
+        }
+        q_power = context.square(q_power);
+    }
+    return false;
 }
 
-}  // namespace
+/// Check number against small primes: 1 if it is one of them or has no divisor among them while being lower than
+/// square of the largest one, 0 if it has a small divisor and -1 if it is unknown.
+int small_primes_test(const yabil::bigint::BigInt &n)
+{
+    for (const auto prime : primes())
+    {
+        const auto small_prime = static_cast<yabil::bigint::bigint_base_t>(prime);
+        if (n.is_uint64() && n.to_uint() == static_cast<uint64_t>(prime))
+        {
+            return 1;
+        }
+        if (n % small_prime == 0)
+        {
+            return 0;
+        }
+    }
 
-yabil::bigint::BigInt random_bigint(uint64_t number_of_bits, bool top_two, bool bottom_odd)
+    const auto largest_prime = static_cast<uint64_t>(primes().back());
+    return n.is_uint64() && n.to_uint() < largest_prime * largest_prime ? 1 : -1;
+}
+
+// Arbitrary limit of candidates per prime, to avoid endless iteration over loop in worst cases
+constexpr unsigned max_number_of_trials = 128000;
+
+void check_prime_size(uint64_t number_of_bits)
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<yabil::bigint::bigint_base_t> dist;
+    if (number_of_bits <= 2)
+    {
+        throw std::invalid_argument("There is no prime of 2 bits size");
+    }
+}
 
-    constexpr std::size_t chunk_size_bits = sizeof(yabil::bigint::bigint_base_t) * 8;
-    const std::size_t bigint_chunks_count = number_of_bits / chunk_size_bits;
+/// Search for primes on calling thread and all threads of the pool. Every worker tests its own candidates, the first
+/// one which completes the result stops the others, also in the middle of Miller-Rabin test.
+std::vector<yabil::bigint::BigInt> parallel_random_primes(std::size_t count, uint64_t number_of_bits)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
 
-    std::vector<yabil::bigint::bigint_base_t> raw_bigint_data;
-    raw_bigint_data.reserve(bigint_chunks_count + 1);
+    std::vector<yabil::bigint::BigInt> primes;
+    primes.reserve(count);
+    std::mutex primes_mutex;
+    std::atomic<bool> stop = false;
+    std::atomic<uint64_t> trials = 0;
+    const uint64_t max_trials = static_cast<uint64_t>(max_number_of_trials) * count;
 
-    for (std::size_t i = 0; i < bigint_chunks_count; i++)
+    const auto search = [&]()
     {
-        raw_bigint_data.push_back(dist(gen));
+        PrimeCandidateSieve sieve(number_of_bits);
+        while (!stop.load(std::memory_order_relaxed) && trials.fetch_add(1, std::memory_order_relaxed) < max_trials)
+        {
+            auto prime_candidate = sieve.next();
+            if (!miller_rabin_test(prime_candidate, &stop))
+            {
+                continue;
+            }
+
+            {
+                const std::lock_guard lock(primes_mutex);
+                if (primes.size() < count)
+                {
+                    primes.push_back(std::move(prime_candidate));
+                }
+                if (primes.size() == count)
+                {
+                    stop = true;
+                }
+            }
+
+            // Primes found close to each other are not independent
+            sieve.restart();
+        }
+    };
+
+    std::vector<std::future<void>> workers;
+    for (std::size_t i = 0; i < thread_pool.thread_count(); ++i)
+    {
+        workers.push_back(thread_pool.submit(search));
+    }
+    search();
+    for (auto &worker : workers)
+    {
+        worker.get();
     }
 
-    const std::size_t bigint_remaining_bits = number_of_bits % chunk_size_bits;
-    if (bigint_remaining_bits)
+    if (primes.size() < count)
     {
-        raw_bigint_data.push_back(dist(gen) >> (chunk_size_bits - bigint_remaining_bits));
+        throw std::runtime_error("Cannot generate prime in: " + std::to_string(max_trials) + " steps");
     }
+    return primes;
+}
+
+}  // namespace
+
+yabil::bigint::BigInt random_bigint(uint64_t number_of_bits, bool top_two, bool bottom_odd)
+{
+    std::vector<yabil::bigint::bigint_base_t> raw_bigint_data(digits_count(number_of_bits));
+    fill_random_digits(raw_bigint_data);
+    mask_top_digit(raw_bigint_data, number_of_bits);
 
     if (bottom_odd)
     {
@@ -135,7 +512,8 @@ yabil::bigint::BigInt random_bigint(uint64_t number_of_bits, bool top_two, bool
 
     if (top_two)
     {
-        raw_bigint_data.back() |= static_cast<yabil::bigint::bigint_base_t>(1) << (chunk_size_bits - 1);
+        const auto top_bit = (number_of_bits - 1) % digit_bits;
+        raw_bigint_data.back() |= static_cast<yabil::bigint::bigint_base_t>(1) << top_bit;
     }
 
     return yabil::bigint::BigInt(std::move(raw_bigint_data));
@@ -143,35 +521,58 @@ yabil::bigint::BigInt random_bigint(uint64_t number_of_bits, bool top_two, bool
 
 yabil::bigint::BigInt random_bigint(const yabil::bigint::BigInt &min, const yabil::bigint::BigInt &max)
 {
-    const uint64_t max_bits = max.byte_size() * 8 - std::countl_zero(max.raw_data().back());
-    auto result = random_bigint(max_bits);
-
-    if (result > max)
+    if (max < min)
     {
-        result -= max;
+        throw std::invalid_argument("Minimum value must not be greater than maximum value");
     }
 
-    if (result < min)
+    const auto range = max - min;
+    if (range.is_zero())
     {
-        result = min;
+        return min;
     }
 
-    return result;
+    // Numbers of the same bit length as range are drawn until one is not greater than range, so every attempt
+    // succeeds with probability greater than 1/2. Digit vectors have equal sizes, so comparing them from the most
+    // significant digit compares the numbers.
+    const auto &range_digits = range.raw_data();
+    const uint64_t range_bits =
+        range_digits.size() * digit_bits - static_cast<uint64_t>(std::countl_zero(range_digits.back()));
+
+    std::vector<yabil::bigint::bigint_base_t> raw_bigint_data(range_digits.size());
+    do
+    {
+        fill_random_digits(raw_bigint_data);
+        mask_top_digit(raw_bigint_data, range_bits);
+    } while (std::lexicographical_compare(range_digits.rbegin(), range_digits.rend(), raw_bigint_data.rbegin(),
+                                          raw_bigint_data.rend()));
+
+    return min + yabil::bigint::BigInt(std::move(raw_bigint_data));
 }
 
-bigint::BigInt random_prime(uint64_t number_of_bits)
+void fill_random(std::span<yabil::bigint::BigInt> numbers, uint64_t number_of_bits)
 {
-    if (number_of_bits <= 2)
+    const std::size_t number_digits = digits_count(number_of_bits);
+
+    std::vector<yabil::bigint::bigint_base_t> raw_data(numbers.size() * number_digits);
+    fill_random_digits(raw_data);
+
+    for (std::size_t i = 0; i < numbers.size(); ++i)
     {
-        throw std::invalid_argument("There is no prime of 2 bits size");
+        const auto digits = std::span(raw_data).subspan(i * number_digits, number_digits);
+        mask_top_digit(digits, number_of_bits);
+        numbers[i] = yabil::bigint::BigInt(std::span<const yabil::bigint::bigint_base_t>(digits));
     }
+}
 
-    // Arbitrary limit to avoid endless iteration over loop in worst cases
-    constexpr unsigned max_number_of_trials = 128000;
+bigint::BigInt random_prime(uint64_t number_of_bits)
+{
+    check_prime_size(number_of_bits);
 
+    PrimeCandidateSieve sieve(number_of_bits);
     for (unsigned i = 0; i < max_number_of_trials; ++i)
     {
-        bigint::BigInt prime_candidate = probable_prime(number_of_bits);
+        bigint::BigInt prime_candidate = sieve.next();
         if (miller_rabin_test(prime_candidate))
         {
             return prime_candidate;
@@ -181,4 +582,63 @@ bigint::BigInt random_prime(uint64_t number_of_bits)
     throw std::runtime_error("Cannot generate prime in: " + std::to_string(max_number_of_trials) + " steps");
 }
 
+std::vector<bigint::BigInt> random_primes(std::size_t count, uint64_t number_of_bits)
+{
+    check_prime_size(number_of_bits);
+
+    std::vector<bigint::BigInt> primes;
+    primes.reserve(count);
+    while (primes.size() < count)
+    {
+        primes.push_back(random_prime(number_of_bits));
+    }
+    return primes;
+}
+
+bool is_probable_prime(const bigint::BigInt &number, PrimalityMode mode)
+{
+    if (number.is_negative() || number < bigint::BigInt(2))
+    {
+        return false;
+    }
+
+    if (const int small_primes_result = small_primes_test(number); small_primes_result != -1)
+    {
+        return small_primes_result == 1;
+    }
+
+    if (mode == PrimalityMode::MillerRabin)
+    {
+        return miller_rabin_test(number);
+    }
+
+    return is_strong_probable_prime(PrimalityTestContext(number), bigint::BigInt(2)) &&
+           is_strong_lucas_probable_prime(number);
+}
+
+namespace parallel
+{
+
+bigint::BigInt random_prime(uint64_t number_of_bits)
+{
+    check_prime_size(number_of_bits);
+    if (utils::ThreadPoolSingleton::instance().is_current_thread_worker())
+    {
+        return random::random_prime(number_of_bits);
+    }
+    return parallel_random_primes(1, number_of_bits).front();
+}
+
+std::vector<bigint::BigInt> random_primes(std::size_t count, uint64_t number_of_bits)
+{
+    check_prime_size(number_of_bits);
+    if (count == 0 || utils::ThreadPoolSingleton::instance().is_current_thread_worker())
+    {
+        return random::random_primes(count, number_of_bits);
+    }
+    return parallel_random_primes(count, number_of_bits);
+}
+
+}  // namespace parallel
+
 }  // namespace yabil::crypto::random
@@ -0,0 +1,122 @@
+#include <yabil/crypto/RandomGenerator.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <span>
+#include <utility>
+
+#include "chacha20/ChaCha20.h"
+
+namespace yabil::crypto::random
+{
+
+namespace
+{
+
+/// Overwrite memory in a way which is not removed by optimizations.
+void secure_wipe(void *data, std::size_t size)
+{
+    auto *bytes = static_cast<volatile uint8_t *>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = 0;
+    }
+}
+
+std::array<uint8_t, ChaCha20Generator::seed_size> random_device_seed()
+{
+    static std::mutex random_device_mutex;
+    static std::random_device rd;
+
+    std::array<uint8_t, ChaCha20Generator::seed_size> seed;
+    const std::lock_guard lock(random_device_mutex);
+    for (std::size_t i = 0; i < seed.size(); i += 4)
+    {
+        const auto value = rd();
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            seed[i + j] = static_cast<uint8_t>(value >> (8 * j));
+        }
+    }
+    return seed;
+}
+
+/// Load ChaCha20 key from little-endian bytes.
+void load_key(std::array<uint32_t, 8> &key, std::span<const uint8_t> bytes)
+{
+    for (std::size_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = static_cast<uint32_t>(bytes[4 * i]) | (static_cast<uint32_t>(bytes[4 * i + 1]) << 8) |
+                 (static_cast<uint32_t>(bytes[4 * i + 2]) << 16) | (static_cast<uint32_t>(bytes[4 * i + 3]) << 24);
+    }
+}
+
+thread_local RandomGenerator *current_thread_generator = nullptr;
+
+}  // namespace
+
+ChaCha20Generator::ChaCha20Generator() : ChaCha20Generator(random_device_seed())
+{
+}
+
+ChaCha20Generator::ChaCha20Generator(const std::array<uint8_t, seed_size> &seed)
+{
+    load_key(key, seed);
+}
+
+ChaCha20Generator::~ChaCha20Generator()
+{
+    secure_wipe(key.data(), sizeof(key));
+    secure_wipe(buffer.data(), buffer.size());
+}
+
+void ChaCha20Generator::fill(std::span<uint8_t> output)
+{
+    while (!output.empty())
+    {
+        if (position == output_size)
+        {
+            refill();
+        }
+
+        const auto count = std::min(output.size(), output_size - position);
+        std::memcpy(output.data(), buffer.data() + position, count);
+        secure_wipe(buffer.data() + position, count);
+        position += count;
+        output = output.subspan(count);
+    }
+}
+
+void ChaCha20Generator::refill()
+{
+    chacha20_blocks(key, buffer);
+
+    // Key for the next batch, never returned to the caller
+    const auto next_key = std::span(buffer).last(seed_size);
+    load_key(key, next_key);
+    secure_wipe(next_key.data(), next_key.size());
+    position = 0;
+}
+
+RandomGenerator &thread_generator()
+{
+    if (current_thread_generator)
+    {
+        return *current_thread_generator;
+    }
+
+    thread_local ChaCha20Generator default_generator;
+    return default_generator;
+}
+
+RandomGenerator *set_thread_generator(RandomGenerator *generator)
+{
+    return std::exchange(current_thread_generator, generator);
+}
+
+}  // namespace yabil::crypto::random
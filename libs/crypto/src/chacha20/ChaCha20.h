@@ -0,0 +1,14 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace yabil::crypto::random
+{
+
+/// Generate consecutive ChaCha20 blocks with counters 0, 1, ... and zero nonce, serialized little-endian.
+/// Size of output must be a multiple of 64 bytes.
+void chacha20_blocks(const std::array<uint32_t, 8> &key, std::span<uint8_t> output);
+
+}  // namespace yabil::crypto::random
@@ -0,0 +1,108 @@
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+
+#include "ChaCha20.h"
+
+namespace yabil::crypto::random
+{
+
+namespace
+{
+
+// Number of blocks computed at once, one in each 32-bit lane
+constexpr std::size_t lanes = 8;
+
+template <int shift>
+__m256i rotl(__m256i x)
+{
+    if constexpr (shift == 16)
+    {
+        const __m256i mask = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2, 13, 12, 15, 14, 9,
+                                             8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+        return _mm256_shuffle_epi8(x, mask);
+    }
+    else if constexpr (shift == 8)
+    {
+        const __m256i mask = _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3, 14, 13, 12, 15, 10,
+                                             9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+        return _mm256_shuffle_epi8(x, mask);
+    }
+    else
+    {
+        return _mm256_or_si256(_mm256_slli_epi32(x, shift), _mm256_srli_epi32(x, 32 - shift));
+    }
+}
+
+void quarter_round(__m256i *x, int a, int b, int c, int d)
+{
+    x[a] = _mm256_add_epi32(x[a], x[b]);
+    x[d] = rotl<16>(_mm256_xor_si256(x[d], x[a]));
+    x[c] = _mm256_add_epi32(x[c], x[d]);
+    x[b] = rotl<12>(_mm256_xor_si256(x[b], x[c]));
+    x[a] = _mm256_add_epi32(x[a], x[b]);
+    x[d] = rotl<8>(_mm256_xor_si256(x[d], x[a]));
+    x[c] = _mm256_add_epi32(x[c], x[d]);
+    x[b] = rotl<7>(_mm256_xor_si256(x[b], x[c]));
+}
+
+}  // namespace
+
+void chacha20_blocks(const std::array<uint32_t, 8> &key, std::span<uint8_t> output)
+{
+    // "expand 32-byte k", key, counter, nonce
+    __m256i input[16];
+    input[0] = _mm256_set1_epi32(0x61707865);
+    input[1] = _mm256_set1_epi32(0x3320646e);
+    input[2] = _mm256_set1_epi32(0x79622d32);
+    input[3] = _mm256_set1_epi32(0x6b206574);
+    for (std::size_t i = 0; i < key.size(); ++i)
+    {
+        input[4 + i] = _mm256_set1_epi32(static_cast<int>(key[i]));
+    }
+    input[12] = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    input[13] = input[14] = input[15] = _mm256_setzero_si256();
+
+    alignas(32) std::array<std::array<uint32_t, lanes>, 16> words;
+    for (std::size_t offset = 0; offset < output.size(); offset += lanes * 64)
+    {
+        __m256i x[16];
+        std::copy(std::begin(input), std::end(input), x);
+        for (int round = 0; round < 10; ++round)
+        {
+            quarter_round(x, 0, 4, 8, 12);
+            quarter_round(x, 1, 5, 9, 13);
+            quarter_round(x, 2, 6, 10, 14);
+            quarter_round(x, 3, 7, 11, 15);
+            quarter_round(x, 0, 5, 10, 15);
+            quarter_round(x, 1, 6, 11, 12);
+            quarter_round(x, 2, 7, 8, 13);
+            quarter_round(x, 3, 4, 9, 14);
+        }
+
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i *>(words[i].data()), _mm256_add_epi32(x[i], input[i]));
+        }
+
+        // Transpose lanes into consecutive blocks, x86 is little-endian
+        const std::size_t blocks = std::min(lanes, (output.size() - offset) / 64);
+        for (std::size_t j = 0; j < blocks; ++j)
+        {
+            for (std::size_t i = 0; i < 16; ++i)
+            {
+                std::memcpy(&output[offset + 64 * j + 4 * i], &words[i][j], 4);
+            }
+        }
+
+        input[12] = _mm256_add_epi32(input[12], _mm256_set1_epi32(lanes));
+    }
+}
+
+}  // namespace yabil::crypto::random
@@ -0,0 +1,68 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "ChaCha20.h"
+
+namespace yabil::crypto::random
+{
+
+namespace
+{
+
+constexpr uint32_t rotl(uint32_t x, int shift)
+{
+    return (x << shift) | (x >> (32 - shift));
+}
+
+void quarter_round(std::array<uint32_t, 16> &x, int a, int b, int c, int d)
+{
+    x[a] += x[b];
+    x[d] = rotl(x[d] ^ x[a], 16);
+    x[c] += x[d];
+    x[b] = rotl(x[b] ^ x[c], 12);
+    x[a] += x[b];
+    x[d] = rotl(x[d] ^ x[a], 8);
+    x[c] += x[d];
+    x[b] = rotl(x[b] ^ x[c], 7);
+}
+
+}  // namespace
+
+void chacha20_blocks(const std::array<uint32_t, 8> &key, std::span<uint8_t> output)
+{
+    // "expand 32-byte k", key, counter, nonce
+    std::array<uint32_t, 16> input = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+    for (std::size_t i = 0; i < key.size(); ++i)
+    {
+        input[4 + i] = key[i];
+    }
+
+    for (std::size_t offset = 0; offset < output.size(); offset += 64, ++input[12])
+    {
+        auto x = input;
+        for (int round = 0; round < 10; ++round)
+        {
+            quarter_round(x, 0, 4, 8, 12);
+            quarter_round(x, 1, 5, 9, 13);
+            quarter_round(x, 2, 6, 10, 14);
+            quarter_round(x, 3, 7, 11, 15);
+            quarter_round(x, 0, 5, 10, 15);
+            quarter_round(x, 1, 6, 11, 12);
+            quarter_round(x, 2, 7, 8, 13);
+            quarter_round(x, 3, 4, 9, 14);
+        }
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            const uint32_t word = x[i] + input[i];
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                output[offset + 4 * i + j] = static_cast<uint8_t>(word >> (8 * j));
+            }
+        }
+    }
+}
+
+}  // namespace yabil::crypto::random
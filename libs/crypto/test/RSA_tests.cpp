@@ -3,7 +3,12 @@
 #include <yabil/crypto/RSA.h>
 #include <yabil/crypto/Random.h>
 
+#include <cstdint>
+#include <cstring>
 #include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
 
 using namespace yabil::crypto;
 using namespace yabil::bigint;
@@ -12,6 +17,24 @@ class RSA_tests : public ::testing::Test
 {
 };
 
+namespace
+{
+
+/// Size of first count items of block stream, without the flag marking the last one.
+std::size_t items_size(const std::string &encrypted, std::size_t count)
+{
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        uint64_t item_size = 0;
+        std::memcpy(&item_size, encrypted.data() + size, sizeof(item_size));
+        size += sizeof(item_size) + (item_size & ~(uint64_t{1} << 63));
+    }
+    return size;
+}
+
+}  // namespace
+
 TEST_F(RSA_tests, canGeneratePrivateAndPublicKey)
 {
     constexpr int key_size = 256;
@@ -23,6 +46,114 @@ TEST_F(RSA_tests, canGeneratePrivateAndPublicKey)
     ASSERT_FALSE(pub_key.d.is_zero());
 }
 
+TEST_F(RSA_tests, generatedPrivateKeyHasCrtComponents)
+{
+    const BigInt p{61}, q{53};
+    const auto [pub_key, private_key] = rsa::generate_keys(p, q);
+
+    ASSERT_TRUE(private_key.has_crt_components());
+    EXPECT_EQ(p, private_key.p);
+    EXPECT_EQ(q, private_key.q);
+    EXPECT_EQ(private_key.d % (p - BigInt(1)), private_key.dP);
+    EXPECT_EQ(private_key.d % (q - BigInt(1)), private_key.dQ);
+    EXPECT_EQ(BigInt(1), (private_key.qInv * q) % p);
+}
+
+TEST_F(RSA_tests, crtDecryptionMatchesPlainDecryption)
+{
+    constexpr int key_size = 512;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const rsa::PrivateKey plain_private_key{private_key.d, private_key.n};
+    ASSERT_FALSE(plain_private_key.has_crt_components());
+
+    // Raw RSA is symmetric, so "decryption" with public exponent encrypts whole number
+    const rsa::PrivateKey encryption_key{pub_key.e, pub_key.n};
+
+    for (const auto &message : {BigInt(0), BigInt(1), BigInt(97), private_key.p, private_key.n - BigInt(1),
+                               random::random_bigint(BigInt(2), private_key.n - BigInt(1))})
+    {
+        const auto encrypted = rsa::decrypt(message, encryption_key);
+        const auto decrypted = rsa::decrypt(encrypted, private_key);
+
+        EXPECT_EQ(message, decrypted);
+        EXPECT_EQ(rsa::decrypt(encrypted, plain_private_key), decrypted);
+    }
+}
+
+TEST_F(RSA_tests, crtDecryptionThrowsForNegativeNumber)
+{
+    constexpr int key_size = 512;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_THROW(rsa::decrypt(BigInt(-5), private_key), std::invalid_argument);
+    }
+    EXPECT_EQ(BigInt(5), rsa::decrypt(rsa::decrypt(BigInt(5), rsa::PrivateKey{pub_key.e, pub_key.n}), private_key));
+}
+
+TEST_F(RSA_tests, blindedDecryptionMatchesDecryption)
+{
+    constexpr int key_size = 256;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const rsa::PrivateKey plain_private_key{private_key.d, private_key.n};
+    const rsa::PrivateKey encryption_key{pub_key.e, pub_key.n};
+
+    rsa::Blinding blinding(private_key);
+    rsa::Blinding plain_blinding(plain_private_key);
+    for (int i = 0; i < 10; ++i)
+    {
+        const auto message = random::random_bigint(BigInt(0), private_key.n - BigInt(1));
+        const auto encrypted = rsa::decrypt(message, encryption_key);
+
+        EXPECT_EQ(message, rsa::decrypt(encrypted, private_key, blinding));
+        EXPECT_EQ(message, rsa::decrypt(encrypted, plain_private_key, plain_blinding));
+    }
+}
+
+TEST_F(RSA_tests, blindingFactorsAreUpdatedBySquaring)
+{
+    const auto [pub_key, private_key] = rsa::generate_keys(BigInt(65537), BigInt(65539));
+    rsa::Blinding blinding(private_key);
+
+    const auto [factor, unblinding_factor] = blinding.next();
+    EXPECT_EQ(BigInt(1), rsa::decrypt(factor, private_key) * unblinding_factor % private_key.n);
+
+    const auto [next_factor, next_unblinding_factor] = blinding.next();
+    EXPECT_EQ(factor * factor % private_key.n, next_factor);
+    EXPECT_EQ(unblinding_factor * unblinding_factor % private_key.n, next_unblinding_factor);
+}
+
+TEST_F(RSA_tests, batchDecryptionMatchesDecryption)
+{
+    constexpr int key_size = 256;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const rsa::PrivateKey plain_private_key{private_key.d, private_key.n};
+    const rsa::PrivateKey encryption_key{pub_key.e, pub_key.n};
+
+    std::vector<BigInt> messages{BigInt(0), BigInt(1), private_key.q, private_key.n - BigInt(1)};
+    for (int i = 0; i < 60; ++i)
+    {
+        messages.push_back(random::random_bigint(BigInt(0), private_key.n - BigInt(1)));
+    }
+
+    std::vector<BigInt> encrypted;
+    for (const auto &message : messages)
+    {
+        encrypted.push_back(rsa::decrypt(message, encryption_key));
+    }
+
+    rsa::Blinding blinding(private_key);
+    EXPECT_EQ(messages, rsa::decrypt_batch(encrypted, private_key));
+    EXPECT_EQ(messages, rsa::decrypt_batch(encrypted, plain_private_key));
+    EXPECT_EQ(messages, rsa::decrypt_batch(encrypted, private_key, blinding));
+    EXPECT_TRUE(rsa::decrypt_batch(std::vector<BigInt>{}, private_key).empty());
+}
+
 TEST_F(RSA_tests, canEncryptSingleCharacter)
 {
     const BigInt n{33}, e{7};
@@ -126,3 +257,276 @@ TEST_F(RSA_tests, canEncryptAndDecryptFromDifferentSources)
     EXPECT_EQ(12, number);
     EXPECT_EQ('.', chr);
 }
+
+TEST_F(RSA_tests, blockSizeFitsBelowModulus)
+{
+    EXPECT_EQ(0, rsa::block_size(BigInt(119)));
+    EXPECT_EQ(0, rsa::block_size(BigInt(255)));
+    EXPECT_EQ(1, rsa::block_size(BigInt(256)));
+    EXPECT_EQ(1, rsa::block_size(BigInt(65535)));
+    EXPECT_EQ(2, rsa::block_size(BigInt(65536)));
+    EXPECT_EQ(63, rsa::block_size(BigInt(1) << 511));
+}
+
+TEST_F(RSA_tests, canEncryptAndDecryptBytesInBlocks)
+{
+    constexpr int key_size = 256;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const auto bytes_per_block = rsa::block_size(pub_key.n);
+
+    std::vector<uint8_t> data;
+    for (const std::size_t size : {std::size_t{0}, std::size_t{1}, bytes_per_block - 1, bytes_per_block,
+                                   bytes_per_block + 1, std::size_t{1000}})
+    {
+        data.resize(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            data[i] = static_cast<uint8_t>(i % 3 == 0 ? 0 : 251 * i);
+        }
+
+        const auto encrypted = rsa::encrypt(data, pub_key);
+        EXPECT_EQ(size / bytes_per_block + 1, encrypted.size());
+        EXPECT_EQ(data, rsa::decrypt(encrypted, private_key));
+    }
+}
+
+TEST_F(RSA_tests, blockEncryptionThrowsForTooSmallModulus)
+{
+    const BigInt n{119}, e{5}, d{77};
+    const std::vector<uint8_t> data{1, 2, 3};
+
+    EXPECT_THROW(rsa::encrypt(data, rsa::PublicKey{e, n}), std::invalid_argument);
+    EXPECT_THROW(rsa::decrypt(std::vector<BigInt>{BigInt(1)}, rsa::PrivateKey{d, n}), std::invalid_argument);
+}
+
+TEST_F(RSA_tests, blockDecryptionThrowsForMissingEndMarker)
+{
+    const auto [pub_key, private_key] = rsa::generate_keys(BigInt(65537), BigInt(65539));
+    const std::vector<uint8_t> data{1, 2, 3, 4};
+
+    auto encrypted = rsa::encrypt(data, pub_key);
+    encrypted.pop_back();
+    EXPECT_THROW(rsa::decrypt(encrypted, private_key), std::invalid_argument);
+    EXPECT_THROW(rsa::decrypt(std::vector<BigInt>{}, private_key), std::invalid_argument);
+}
+
+TEST_F(RSA_tests, canEncryptAndDecryptMessageWithBlockStreams)
+{
+    constexpr int key_size = 128;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+
+    std::ostringstream os;
+    {
+        rsa::BlockEncryptionStreamWrapper encryption_stream(os, pub_key);
+        encryption_stream << "Message: " << 12 << ' ' << '.' << " and some longer text to fill a few blocks";
+    }
+
+    std::istringstream in(os.str());
+    rsa::BlockDecryptionStreamWrapper decryption_stream(in, private_key);
+
+    std::string message;
+    int number;
+    char chr;
+
+    decryption_stream >> message >> number >> chr;
+    EXPECT_EQ("Message:", message);
+    EXPECT_EQ(12, number);
+    EXPECT_EQ('.', chr);
+    EXPECT_EQ("and some longer text to fill a few blocks", decryption_stream.read_all());
+}
+
+TEST_F(RSA_tests, blockStreamIsSmallerThanByteStream)
+{
+    constexpr int key_size = 128;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const std::string msg(500, 'x');
+
+    std::ostringstream byte_stream, block_stream;
+    rsa::EncryptionStreamWrapper(byte_stream, pub_key) << msg;
+    rsa::BlockEncryptionStreamWrapper block_encryption_stream(block_stream, pub_key);
+    block_encryption_stream << msg;
+    block_encryption_stream.finish();
+
+    EXPECT_LT(block_stream.str().size() * 10, byte_stream.str().size());
+    EXPECT_THROW(block_encryption_stream << msg, std::runtime_error);
+
+    std::istringstream in(block_stream.str());
+    EXPECT_EQ(msg, rsa::BlockDecryptionStreamWrapper(in, private_key).read_all());
+}
+
+TEST_F(RSA_tests, blockStreamsGiveSameResultForAnyBatchSize)
+{
+    constexpr int key_size = 128;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const auto bytes_per_block = rsa::block_size(pub_key.n);
+
+    for (const std::size_t size : {std::size_t{0}, bytes_per_block * 3 - 1, bytes_per_block * 3, std::size_t{5000}})
+    {
+        std::string msg(size, '\0');
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            msg[i] = static_cast<char>('a' + i % 26);
+        }
+
+        std::ostringstream expected;
+        rsa::BlockEncryptionStreamWrapper(expected, pub_key, 1) << msg;
+
+        for (const std::size_t batch_blocks : {std::size_t{2}, std::size_t{3}, rsa::default_stream_batch_blocks})
+        {
+            std::ostringstream os;
+            {
+                rsa::BlockEncryptionStreamWrapper encryption_stream(os, pub_key, batch_blocks);
+                encryption_stream << msg.substr(0, size / 2);
+                encryption_stream << msg.substr(size / 2);
+            }
+            EXPECT_EQ(expected.str(), os.str());
+
+            std::istringstream in(os.str());
+            EXPECT_EQ(msg, rsa::BlockDecryptionStreamWrapper(in, private_key, batch_blocks).read_all());
+        }
+    }
+}
+
+TEST_F(RSA_tests, blockDecryptionStreamReadsAcrossBatches)
+{
+    constexpr int key_size = 64;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+
+    std::ostringstream os;
+    {
+        rsa::BlockEncryptionStreamWrapper encryption_stream(os, pub_key, 2);
+        for (int i = 0; i < 100; ++i)
+        {
+            encryption_stream << i << ' ';
+        }
+    }
+
+    std::istringstream in(os.str());
+    rsa::BlockDecryptionStreamWrapper decryption_stream(in, private_key, 2);
+    for (int i = 0; i < 100; ++i)
+    {
+        int number = -1;
+        decryption_stream >> number;
+        EXPECT_EQ(i, number);
+    }
+    EXPECT_EQ("", decryption_stream.read_all());
+}
+
+TEST_F(RSA_tests, blockDecryptionStreamThrowsForStreamEndingAfterFullBatch)
+{
+    constexpr int key_size = 64;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+
+    std::ostringstream os;
+    rsa::BlockEncryptionStreamWrapper(os, pub_key, 2) << std::string(100, 'x');
+    const auto encrypted = os.str();
+
+    // Keep first two items, which make a full batch, followed by a few bytes too short for another item
+    std::istringstream in(encrypted.substr(0, items_size(encrypted, 2)) + "abc");
+    EXPECT_THROW(rsa::BlockDecryptionStreamWrapper(in, private_key, 2).read_all(), std::invalid_argument);
+}
+
+TEST_F(RSA_tests, blockDecryptionStreamStopsAfterLastBlock)
+{
+    constexpr int key_size = 64;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const std::string msg(100, 'x');
+
+    std::ostringstream os;
+    rsa::BlockEncryptionStreamWrapper(os, pub_key, 2) << msg;
+    os << "trailing data";
+    rsa::BlockEncryptionStreamWrapper(os, pub_key, 2) << msg;
+
+    std::istringstream in(os.str());
+    EXPECT_EQ(msg, rsa::BlockDecryptionStreamWrapper(in, private_key, 2).read_all());
+
+    std::string trailing_data(13, '\0');
+    in.read(trailing_data.data(), static_cast<std::streamsize>(trailing_data.size()));
+    EXPECT_EQ("trailing data", trailing_data);
+    EXPECT_EQ(msg, rsa::BlockDecryptionStreamWrapper(in, private_key, 3).read_all());
+}
+
+TEST_F(RSA_tests, blockDecryptionStreamThrowsForStreamWithoutLastBlock)
+{
+    constexpr int key_size = 64;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const auto bytes_per_block = rsa::block_size(pub_key.n);
+
+    std::ostringstream os;
+    rsa::BlockEncryptionStreamWrapper(os, pub_key) << std::string(bytes_per_block * 3, 'x');
+    const auto encrypted = os.str();
+    ASSERT_EQ(encrypted.size(), items_size(encrypted, 4));
+
+    // Stream cut at item boundary before the last block
+    for (const std::size_t batch_blocks : {std::size_t{1}, std::size_t{2}, rsa::default_stream_batch_blocks})
+    {
+        for (const std::size_t items : {std::size_t{0}, std::size_t{1}, std::size_t{3}})
+        {
+            std::istringstream in(encrypted.substr(0, items_size(encrypted, items)));
+            EXPECT_THROW(rsa::BlockDecryptionStreamWrapper(in, private_key, batch_blocks).read_all(),
+                         std::invalid_argument);
+        }
+
+        // Stream cut inside size field or inside digits of an item
+        for (const std::size_t size : {std::size_t{4}, std::size_t{12}, items_size(encrypted, 2) + 3,
+                                       encrypted.size() - 3})
+        {
+            std::istringstream in(encrypted.substr(0, size));
+            EXPECT_THROW(rsa::BlockDecryptionStreamWrapper(in, private_key, batch_blocks).read_all(),
+                         std::invalid_argument);
+        }
+    }
+}
+
+TEST_F(RSA_tests, decryptionStreamsThrowForItemLongerThanModulus)
+{
+    constexpr int key_size = 64;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+
+    for (const uint64_t item_size : {uint64_t{17}, (uint64_t{1} << 62) + 5, (uint64_t{1} << 63) | 17})
+    {
+        std::string encrypted(sizeof(item_size), '\0');
+        std::memcpy(encrypted.data(), &item_size, sizeof(item_size));
+        encrypted += std::string(32, 'x');
+
+        std::istringstream block_in(encrypted);
+        EXPECT_THROW(rsa::BlockDecryptionStreamWrapper(block_in, private_key).read_all(), std::invalid_argument);
+
+        std::istringstream byte_in(encrypted);
+        EXPECT_THROW(rsa::DecryptionStreamWrapper(byte_in, private_key).read_all(), std::invalid_argument);
+    }
+}
+
+TEST_F(RSA_tests, blockEncryptionStreamReportsWriteErrorsOnlyFromFinish)
+{
+    // Buffer without space, every write sets badbit
+    struct FailingBuffer : std::streambuf
+    {
+    } buffer;
+    std::ostream os(&buffer);
+    os.exceptions(std::ios::badbit);
+
+    constexpr int key_size = 64;
+    const auto [pub_key, private_key] =
+        rsa::generate_keys(random::random_prime(key_size), random::random_prime(key_size));
+    const std::string msg(200, 'x');
+
+    {
+        // Destructor waits for pending batch and does not throw
+        rsa::BlockEncryptionStreamWrapper encryption_stream(os, pub_key, 2);
+        EXPECT_THROW(encryption_stream << msg, std::ios::failure);
+    }
+
+    os.clear();
+    rsa::BlockEncryptionStreamWrapper encryption_stream(os, pub_key, 2);
+    EXPECT_THROW(encryption_stream.finish(), std::ios::failure);
+}
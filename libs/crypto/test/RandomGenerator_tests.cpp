@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/crypto/Random.h>
+#include <yabil/crypto/RandomGenerator.h>
+
+#include <array>
+#include <cstdint>
+#include <future>
+#include <set>
+#include <span>
+#include <vector>
+
+using namespace yabil::crypto::random;
+using namespace yabil::bigint;
+
+class RandomGenerator_tests : public ::testing::Test
+{
+};
+
+TEST_F(RandomGenerator_tests, chacha20GeneratorProducesKeystreamOfSeed)
+{
+    // ChaCha20 keystream for zero key and zero nonce, block counters 0 and 1 (RFC 7539, appendix A.1)
+    const std::vector<uint8_t> expected = {
+        0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5, 0x53, 0x86, 0xbd, 0x28,
+        0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a, 0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7,
+        0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48, 0x8d, 0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37,
+        0x6a, 0x43, 0xb8, 0xf4, 0x15, 0x18, 0xa1, 0x1c, 0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86,
+        0x9f, 0x07, 0xe7, 0xbe, 0x55, 0x51, 0x38, 0x7a, 0x98, 0xba, 0x97, 0x7c, 0x73, 0x2d, 0x08, 0x0d,
+        0xcb, 0x0f, 0x29, 0xa0, 0x48, 0xe3, 0x65, 0x69, 0x12, 0xc6, 0x53, 0x3e, 0x32, 0xee, 0x7a, 0xed,
+        0x29, 0xb7, 0x21, 0x76, 0x9c, 0xe6, 0x4e, 0x43, 0xd5, 0x71, 0x33, 0xb0, 0x74, 0xd8, 0x39, 0xd5,
+        0x31, 0xed, 0x1f, 0x28, 0x51, 0x0a, 0xfb, 0x45, 0xac, 0xe1, 0x0a, 0x1f, 0x4b, 0x79, 0x4d, 0x6f};
+
+    ChaCha20Generator generator(std::array<uint8_t, ChaCha20Generator::seed_size>{});
+    std::vector<uint8_t> output(expected.size());
+    generator.fill(output);
+    EXPECT_EQ(expected, output);
+}
+
+TEST_F(RandomGenerator_tests, generatorsWithEqualSeedsProduceEqualSequences)
+{
+    std::array<uint8_t, ChaCha20Generator::seed_size> seed{};
+    seed[0] = 42;
+    ChaCha20Generator first(seed), second(seed);
+
+    // Crosses several batch boundaries with different chunking
+    std::vector<uint8_t> whole(5000), pieces(5000);
+    first.fill(whole);
+    for (std::size_t i = 0; i < pieces.size(); i += 7)
+    {
+        second.fill(std::span(pieces).subspan(i, std::min<std::size_t>(7, pieces.size() - i)));
+    }
+    EXPECT_EQ(whole, pieces);
+
+    seed[0] = 43;
+    ChaCha20Generator other(seed);
+    std::vector<uint8_t> other_output(whole.size());
+    other.fill(other_output);
+    EXPECT_NE(whole, other_output);
+}
+
+TEST_F(RandomGenerator_tests, injectedGeneratorMakesRandomNumbersReproducible)
+{
+    const std::array<uint8_t, ChaCha20Generator::seed_size> seed = {1, 2, 3};
+
+    ChaCha20Generator first(seed);
+    auto *previous = set_thread_generator(&first);
+    EXPECT_EQ(nullptr, previous);
+    EXPECT_EQ(&first, &thread_generator());
+    const auto first_number = random_bigint(1000);
+    const auto first_prime = random_prime(128);
+
+    ChaCha20Generator second(seed);
+    EXPECT_EQ(&first, set_thread_generator(&second));
+    EXPECT_EQ(first_number, random_bigint(1000));
+    EXPECT_EQ(first_prime, random_prime(128));
+
+    EXPECT_EQ(&second, set_thread_generator(nullptr));
+    EXPECT_NE(first_number, random_bigint(1000));
+}
+
+TEST_F(RandomGenerator_tests, threadsUseSeparateGenerators)
+{
+    std::vector<std::future<BigInt>> futures;
+    for (int i = 0; i < 8; ++i)
+    {
+        futures.push_back(std::async(std::launch::async, [] { return random_bigint(256); }));
+    }
+
+    std::set<BigInt> numbers;
+    for (auto &future : futures)
+    {
+        numbers.insert(future.get());
+    }
+    EXPECT_EQ(futures.size(), numbers.size());
+}
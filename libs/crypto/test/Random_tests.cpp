@@ -2,8 +2,10 @@
 #include <yabil/bigint/BigInt.h>
 #include <yabil/crypto/Random.h>
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 using namespace yabil::crypto::random;
 using namespace yabil::bigint;
@@ -47,6 +49,47 @@ TEST_F(UtilsRandom_tests, canGenerateRandomNumberFromGivenRange_1)
     ASSERT_TRUE(num >= min && num <= max);
 }
 
+TEST_F(UtilsRandom_tests, randomNumbersFromRangeAreUniform)
+{
+    // Range [-3, 4], expected count of each value is 2000 with standard deviation about 42
+    std::vector<int> counts(8);
+    for (int i = 0; i < 16000; ++i)
+    {
+        const auto num = random_bigint(BigInt(-3), BigInt(4));
+        ASSERT_TRUE(num >= BigInt(-3) && num <= BigInt(4));
+        ++counts[static_cast<std::size_t>(num.to_int() + 3)];
+    }
+
+    for (const auto count : counts)
+    {
+        EXPECT_GT(count, 1750);
+        EXPECT_LT(count, 2250);
+    }
+}
+
+TEST_F(UtilsRandom_tests, randomNumberFromSingleValueRange)
+{
+    const BigInt value("-123456789012345678901234567890");
+    EXPECT_EQ(value, random_bigint(value, value));
+    EXPECT_THROW(random_bigint(BigInt(2), BigInt(1)), std::invalid_argument);
+}
+
+TEST_F(UtilsRandom_tests, canFillManyRandomNumbers)
+{
+    std::vector<BigInt> numbers(100, BigInt(-1));
+    fill_random(numbers, 100);
+
+    const BigInt limit = BigInt(1) << 100;
+    for (const auto &num : numbers)
+    {
+        ASSERT_GE(num, BigInt(0));
+        ASSERT_LT(num, limit);
+    }
+    std::sort(numbers.begin(), numbers.end());
+    EXPECT_EQ(numbers.end(), std::adjacent_find(numbers.begin(), numbers.end()));
+    EXPECT_TRUE(std::any_of(numbers.begin(), numbers.end(), [&](const BigInt &num) { return num.get_bit(99); }));
+}
+
 TEST_F(UtilsRandom_tests, canGenerateLargeRandomPrimeNumber)
 {
     ASSERT_NO_THROW({ [[maybe_unused]] const BigInt num = random_prime(128); });
@@ -54,3 +97,102 @@ TEST_F(UtilsRandom_tests, canGenerateLargeRandomPrimeNumber)
     ASSERT_NO_THROW({ [[maybe_unused]] const BigInt num = random_prime(1024); });
 #endif
 }
+
+TEST_F(UtilsRandom_tests, canGenerateManyRandomPrimes)
+{
+    const auto primes = random_primes(4, 128);
+    ASSERT_EQ(4, primes.size());
+    for (const auto &prime : primes)
+    {
+        EXPECT_TRUE(prime.get_bit(127));
+        EXPECT_FALSE(prime.get_bit(128));
+        EXPECT_FALSE(prime.is_even());
+    }
+    EXPECT_TRUE(random_primes(0, 128).empty());
+}
+
+TEST_F(UtilsRandom_tests, canGenerateRandomPrimesInParallel)
+{
+    const auto prime = parallel::random_prime(192);
+    EXPECT_TRUE(prime.get_bit(191));
+    EXPECT_FALSE(prime.get_bit(192));
+
+    const auto primes = parallel::random_primes(6, 128);
+    ASSERT_EQ(6, primes.size());
+    for (const auto &p : primes)
+    {
+        EXPECT_TRUE(p.get_bit(127));
+        EXPECT_FALSE(p.get_bit(128));
+        EXPECT_FALSE(p.is_even());
+    }
+    EXPECT_THROW(parallel::random_prime(2), std::invalid_argument);
+    EXPECT_THROW(parallel::random_primes(3, 1), std::invalid_argument);
+}
+
+TEST_F(UtilsRandom_tests, randomPrimeHasRequestedNumberOfBits)
+{
+    for (const uint64_t bits : {3, 4, 5, 13, 100, 200})
+    {
+        const auto prime = random_prime(bits);
+        EXPECT_TRUE(prime.get_bit(bits - 1));
+        EXPECT_FALSE(prime.get_bit(bits));
+    }
+}
+
+TEST_F(UtilsRandom_tests, canGenerateSmallRandomPrimes)
+{
+    const std::vector<uint64_t> small_primes{2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31};
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto prime = random_prime(3 + i % 3).to_uint();
+        EXPECT_NE(small_primes.end(), std::find(small_primes.begin(), small_primes.end(), prime)) << prime;
+    }
+}
+
+TEST_F(UtilsRandom_tests, isProbablePrimeForSmallNumbers)
+{
+    const std::vector<uint64_t> small_primes{2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
+    for (uint64_t n = 0; n < 50; ++n)
+    {
+        const bool is_prime = std::find(small_primes.begin(), small_primes.end(), n) != small_primes.end();
+        EXPECT_EQ(is_prime, is_probable_prime(BigInt(n))) << n;
+        EXPECT_EQ(is_prime, is_probable_prime(BigInt(n), PrimalityMode::BailliePSW)) << n;
+    }
+    EXPECT_FALSE(is_probable_prime(BigInt(-7)));
+    EXPECT_TRUE(is_probable_prime(BigInt(17863)));
+    EXPECT_FALSE(is_probable_prime(BigInt(17863) * BigInt(17881), PrimalityMode::BailliePSW));
+}
+
+TEST_F(UtilsRandom_tests, isProbablePrimeForLargeNumbers)
+{
+    const BigInt primes[] = {BigInt("618970019642690137449562111"),
+                             BigInt("170141183460469231731687303715884105727"),
+                             BigInt("340282366920938463463374607431768211507"), BigInt(1000000007)};
+    const BigInt composites[] = {
+        BigInt("4951760154835678088235319297"),
+        BigInt("170141183460469231731687303715884105727") * BigInt("618970019642690137449562111"),
+        BigInt(1000000007) * BigInt(1000000007),
+        // Strong pseudoprimes to all prime bases up to 23 and up to 37
+        BigInt("3825123056546413051"), BigInt("318665857834031151167461")};
+
+    for (const auto mode : {PrimalityMode::MillerRabin, PrimalityMode::BailliePSW})
+    {
+        for (const auto &prime : primes)
+        {
+            EXPECT_TRUE(is_probable_prime(prime, mode)) << prime;
+        }
+        for (const auto &composite : composites)
+        {
+            EXPECT_FALSE(is_probable_prime(composite, mode)) << composite;
+        }
+    }
+}
+
+TEST_F(UtilsRandom_tests, randomPrimesPassBailliePSW)
+{
+    for (const auto &prime : random_primes(3, 256))
+    {
+        EXPECT_TRUE(is_probable_prime(prime, PrimalityMode::BailliePSW));
+        EXPECT_FALSE(is_probable_prime(prime * random_prime(64), PrimalityMode::BailliePSW));
+    }
+}
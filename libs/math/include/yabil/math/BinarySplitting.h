@@ -0,0 +1,59 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/math_export.h>
+
+#include <cstdint>
+#include <functional>
+
+namespace yabil::math
+{
+
+/// @brief Hypergeometric series sum(a(k) * p(0) * ... * p(k) / (q(0) * ... * q(k))) defined by its term ratio.
+struct HypergeometricSeries
+{
+    /// @brief Numerator of the ratio of term k to term k - 1
+    std::function<yabil::bigint::BigInt(uint64_t)> p;
+
+    /// @brief Denominator of the ratio of term k to term k - 1
+    std::function<yabil::bigint::BigInt(uint64_t)> q;
+
+    /// @brief Polynomial factor of term k
+    std::function<yabil::bigint::BigInt(uint64_t)> a;
+};
+
+/// @brief Partial result of binary splitting for the range of terms [begin, end).
+/// @details P = p(begin) * ... * p(end - 1), Q = q(begin) * ... * q(end - 1) and
+/// T / Q = sum of a(k) * p(begin) * ... * p(k) / (q(begin) * ... * q(k)) for k in [begin, end).
+struct BinarySplittingResult
+{
+    yabil::bigint::BigInt P;
+    yabil::bigint::BigInt Q;
+    yabil::bigint::BigInt T;
+};
+
+/// @brief Sum terms of hypergeometric series with binary splitting.
+/// @details Range of terms is split in halves recursively and partial results are combined with
+/// P = P1 * P2, Q = Q1 * Q2 and T = T1 * Q2 + P1 * T2, so all multiplications have balanced operands.
+/// @param series Series to sum
+/// @param begin First term to sum
+/// @param end Term after the last term to sum
+/// @return \p BinarySplittingResult for range [begin, end), sum of the terms is equal to T / Q
+YABIL_MATH_EXPORT BinarySplittingResult binary_splitting(const HypergeometricSeries &series, uint64_t begin,
+                                                         uint64_t end);
+
+namespace parallel
+{
+
+/// @brief Sum terms of hypergeometric series with binary splitting using multiple threads.
+/// @details Range of terms is split into subranges computed concurrently on the thread pool.
+/// @param series Series to sum, its functions may be called from multiple threads
+/// @param begin First term to sum
+/// @param end Term after the last term to sum
+/// @return \p BinarySplittingResult for range [begin, end), sum of the terms is equal to T / Q
+YABIL_MATH_EXPORT BinarySplittingResult binary_splitting(const HypergeometricSeries &series, uint64_t begin,
+                                                         uint64_t end);
+
+}  // namespace parallel
+
+}  // namespace yabil::math
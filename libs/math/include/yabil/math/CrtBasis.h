@@ -0,0 +1,59 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/ProductTree.h>
+#include <yabil/math/math_export.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace yabil::math
+{
+
+/// @brief Precomputed moduli data for reconstruction with Chinese Remainder Theorem.
+/// @details Basis keeps product tree of the moduli and inverses of M / m_i modulo m_i, where M is the product
+/// of all moduli. Single basis can be reused for any number of reconstructions with the same moduli.
+class CrtBasis
+{
+private:
+    ProductTree moduli_tree;
+    std::vector<yabil::bigint::BigInt> cofactor_inverses;
+
+public:
+    /// @brief Create basis for given moduli.
+    /// @param moduli Pairwise coprime positive moduli
+    /// @throws std::invalid_argument when any modulus is not positive or moduli are not pairwise coprime
+    YABIL_MATH_EXPORT explicit CrtBasis(std::span<const yabil::bigint::BigInt> moduli);
+
+    /// @brief Get product of all moduli.
+    /// @return \p BigInt product M of the moduli
+    YABIL_MATH_EXPORT const yabil::bigint::BigInt &modulus() const;
+
+    /// @brief Get moduli of the basis.
+    /// @return \p std::vector<BigInt> moduli in the same order as given to constructor
+    YABIL_MATH_EXPORT const std::vector<yabil::bigint::BigInt> &moduli() const;
+
+    /// @brief Get number of moduli.
+    /// @return Number of moduli in the basis
+    YABIL_MATH_EXPORT std::size_t size() const;
+
+    /// @brief Get product tree of the moduli.
+    /// @return \p ProductTree with moduli as leaves
+    YABIL_MATH_EXPORT const ProductTree &tree() const;
+
+    /// @brief Get inverses of the moduli cofactors.
+    /// @return \p std::vector<BigInt> of (M / m_i)^-1 mod m_i in the same order as moduli
+    YABIL_MATH_EXPORT const std::vector<yabil::bigint::BigInt> &inverses() const;
+};
+
+/// @brief Reconstruct number from its residues with Chinese Remainder Theorem
+/// @details Partial results are combined along the product tree of the basis, so the reconstruction takes
+/// O(M(n) log n) time for n-bit modulus.
+/// @throws std::invalid_argument when number of residues is different than number of moduli in the basis
+/// @param residues Residues modulo consecutive moduli of the basis
+/// @param basis Precomputed moduli basis
+/// @return \p BigInt x in range [0, M) such that x = residues[i] (mod m_i)
+YABIL_MATH_EXPORT yabil::bigint::BigInt crt(std::span<const yabil::bigint::BigInt> residues, const CrtBasis &basis);
+
+}  // namespace yabil::math
@@ -4,7 +4,9 @@
 #include <yabil/math/math_export.h>
 
 #include <cstdint>
+#include <span>
 #include <utility>
+#include <vector>
 
 /// @brief Common mathematical functions for \p BigInt
 namespace yabil::math
@@ -26,11 +28,84 @@ YABIL_MATH_EXPORT yabil::bigint::BigInt pow(const yabil::bigint::BigInt &number,
 YABIL_MATH_EXPORT yabil::bigint::BigInt pow(const yabil::bigint::BigInt &number, const yabil::bigint::BigInt &n,
                                             const yabil::bigint::BigInt &mod);
 
+/// @brief Perform modular exponentiation in time independent of values of the arguments.
+/// @details Perform: number**n % mod, see \p MontgomeryContext::pow_consttime. Intended for secret exponents, e.g.
+/// private keys. Reduction of number not lower than modulus is not constant-time.
+/// @param number Number
+/// @param n Exponent
+/// @param mod Odd modulus greater than 1
+/// @return \p BigInt result of the exponentiation
+/// @throws std::invalid_argument when any argument is negative or modulus is even or equal to 1
+YABIL_MATH_EXPORT yabil::bigint::BigInt pow_consttime(const yabil::bigint::BigInt &number,
+                                                      const yabil::bigint::BigInt &n,
+                                                      const yabil::bigint::BigInt &mod);
+
 /// @brief Calculate factorial of the number n.
+/// @details Uses Luschny's prime swing algorithm, so the result is built from balanced products of prime powers.
 /// @param n Number to calculate factorial for
 /// @return \p BigInt Factorial of n
 YABIL_MATH_EXPORT yabil::bigint::BigInt factorial(uint64_t n);
 
+/// @brief Calculate binomial coefficient n choose k.
+/// @details Result is built from prime powers given by Kummer's theorem, multiplied with balanced product tree.
+///          When min(k, n - k) is small compared to n, factors (n - k, n] are multiplied and divided by k! instead,
+///          so the cost does not grow with n.
+/// @param n Size of the set
+/// @param k Size of the subset
+/// @return \p BigInt n! / (k! * (n - k)!), 0 when k > n
+YABIL_MATH_EXPORT yabil::bigint::BigInt binomial(uint64_t n, uint64_t k);
+
+/// @brief Calculate multinomial coefficient.
+/// @details Result is built from prime powers given by Legendre's formula, multiplied with balanced product tree.
+///          When one part dominates the sum, the remaining factors of the sum factorial are multiplied and divided by
+///          factorials of the other parts instead.
+/// @throws std::invalid_argument when sum of \p k does not fit into 64 bits
+/// @param k Sizes of the groups
+/// @return \p BigInt (k_1 + ... + k_m)! / (k_1! * ... * k_m!)
+YABIL_MATH_EXPORT yabil::bigint::BigInt multinomial(std::span<const uint64_t> k);
+
+/// @brief Calculate primorial of the number n.
+/// @param n Upper bound of primes
+/// @return \p BigInt product of all primes not greater than n
+YABIL_MATH_EXPORT yabil::bigint::BigInt primorial(uint64_t n);
+
+/// @brief Calculate double factorial of the number n.
+/// @param n Number to calculate double factorial for
+/// @return \p BigInt n * (n - 2) * (n - 4) * ...
+YABIL_MATH_EXPORT yabil::bigint::BigInt double_factorial(uint64_t n);
+
+/// @brief Calculate n-th Fibonacci number.
+/// @details Uses fast doubling, which needs two squarings per bit of \p n.
+/// @param n Index of Fibonacci number
+/// @return \p BigInt F(n), where F(0) = 0 and F(1) = 1
+YABIL_MATH_EXPORT yabil::bigint::BigInt fibonacci(uint64_t n);
+
+/// @brief Calculate n-th Lucas number.
+/// @details Computed from F(n) and F(n - 1) given by fast doubling.
+/// @param n Index of Lucas number
+/// @return \p BigInt L(n), where L(0) = 2 and L(1) = 1
+YABIL_MATH_EXPORT yabil::bigint::BigInt lucas(uint64_t n);
+
+/// @brief Calculate n-th Fibonacci number modulo m.
+/// @details Uses fast doubling with Montgomery multiplication for odd moduli and Barrett reduction for even ones.
+/// @throws std::invalid_argument when \p n is negative or \p m is not positive
+/// @param n Index of Fibonacci number
+/// @param m Modulus
+/// @return \p BigInt F(n) mod m
+YABIL_MATH_EXPORT yabil::bigint::BigInt fibonacci_mod(const yabil::bigint::BigInt &n, const yabil::bigint::BigInt &m);
+
+/// @brief Calculate decimal digits of pi.
+/// @details Chudnovsky series is summed with binary splitting.
+/// @param digits Number of digits after the decimal point
+/// @return \p BigInt floor(pi * 10^digits)
+YABIL_MATH_EXPORT yabil::bigint::BigInt pi(uint64_t digits);
+
+/// @brief Calculate decimal digits of Euler's number e.
+/// @details Series of inverted factorials is summed with binary splitting.
+/// @param digits Number of digits after the decimal point
+/// @return \p BigInt floor(e * 10^digits)
+YABIL_MATH_EXPORT yabil::bigint::BigInt e(uint64_t digits);
+
 /// @brief Calculate integer part of binary logarithm of specified number.
 /// @param number \p BigInt Number to calculate logarithm for
 /// @return Integer part of binary logarithm result
@@ -51,12 +126,16 @@ YABIL_MATH_EXPORT double log(const yabil::bigint::BigInt &number, const yabil::b
 YABIL_MATH_EXPORT double log(const yabil::bigint::BigInt &number, double base = 10);
 
 /// @brief Calculate greatest common divisor of two big integers
+/// @details Uses batched binary algorithm for small numbers, Lehmer's algorithm for medium-sized numbers and
+///          subquadratic half-gcd for large numbers.
 /// @param number First \p BigInt number
 /// @param other Second \p BigInt number
 /// @return Greatest common divisor
 YABIL_MATH_EXPORT yabil::bigint::BigInt gcd(yabil::bigint::BigInt number, yabil::bigint::BigInt other);
 
 /// @brief Calculate extended gcd for two big integers
+/// @details Follows the same reduction as \p gcd, but only cofactor of one number is tracked, the second
+///          one is recovered at the end. Returned gcd is never negative.
 /// @param a First \p BigInt number
 /// @param b Second \p BigInt number
 /// @return \p std::pair<BigInt,std::pair<BigInt,BigInt>> greatest common divisor and Bezout coefficients
@@ -64,20 +143,77 @@ YABIL_MATH_EXPORT std::pair<yabil::bigint::BigInt, std::pair<yabil::bigint::BigI
 extended_gcd(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &b);
 
 /// @brief Calculate multiplicative inverse of a for modulo n
+/// @throws std::runtime_error when \p a is not invertible modulo \p n
 /// @param a First \p BigInt number
 /// @param n \p BigInt Modulus
 /// @return \p BigInt Result of the inversion
 YABIL_MATH_EXPORT yabil::bigint::BigInt mod_inverse(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &n);
 
+/// @brief Calculate multiplicative inverses of all numbers modulo n
+/// @details Uses Montgomery's trick: single \p mod_inverse call and 3(k-1) modular multiplications for k numbers.
+/// @throws std::runtime_error when any of the numbers is not invertible modulo \p n
+/// @param numbers Numbers to invert
+/// @param n \p BigInt Modulus
+/// @return \p std::vector<BigInt> inverses in the same order as \p numbers
+YABIL_MATH_EXPORT std::vector<yabil::bigint::BigInt> batch_mod_inverse(std::span<const yabil::bigint::BigInt> numbers,
+                                                                       const yabil::bigint::BigInt &n);
+
+/// @brief Calculate Jacobi symbol (a | n)
+/// @details Uses binary algorithm with steps batched on leading and trailing bits of the numbers.
+/// @throws std::invalid_argument when \p n is not odd positive number
+/// @param a \p BigInt number
+/// @param n \p BigInt odd positive number
+/// @return -1, 0 or 1
+YABIL_MATH_EXPORT int jacobi(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &n);
+
+/// @brief Calculate Kronecker symbol (a | n), extension of Jacobi symbol for any n
+/// @param a \p BigInt number
+/// @param n \p BigInt number
+/// @return -1, 0 or 1
+YABIL_MATH_EXPORT int kronecker(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &n);
+
+/// @brief Calculate square root of a modulo prime p
+/// @details Uses single exponentiation for p = 3 (mod 4) and p = 5 (mod 8), Tonelli-Shanks or Cipolla's algorithm
+///          otherwise. All the steps are computed in single Montgomery context.
+/// @throws std::invalid_argument when \p p is not prime (not every composite modulus is detected)
+/// @throws std::runtime_error when \p a is not a quadratic residue modulo \p p
+/// @param a \p BigInt number
+/// @param p \p BigInt prime modulus
+/// @return \p BigInt r in range [0, p / 2], such that r^2 = a (mod p), the second root is p - r
+YABIL_MATH_EXPORT yabil::bigint::BigInt sqrt_mod(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &p);
+
 /// @brief Calculate square root of given \p BigInt
 /// @param n Number to calculate square root of
-/// @return Ceil of square root from input number
+/// @return Floor of square root from input number
 YABIL_MATH_EXPORT yabil::bigint::BigInt sqrt(const yabil::bigint::BigInt &n);
 
+/// @brief Calculate square root of given \p BigInt together with the remainder
+/// @details Uses recursive Karatsuba square root (Zimmermann), which costs about as much as single division.
+/// @param n Number to calculate square root of
+/// @return \p std::pair<BigInt,BigInt> of s = floor(sqrt(n)) and remainder n - s^2
+YABIL_MATH_EXPORT std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt> sqrtrem(const yabil::bigint::BigInt &n);
+
 /// @brief Calculate k-th root of given \p BigInt
 /// @param n Number to calculate root of
 /// @param k Degree of root to calculate
-/// @return Ceil of k-th root from input number
+/// @return Floor of k-th root from input number
 YABIL_MATH_EXPORT yabil::bigint::BigInt root(const yabil::bigint::BigInt &n, const yabil::bigint::BigInt &k);
 
+/// @copydoc yabil::math::root(const yabil::bigint::BigInt &, const yabil::bigint::BigInt &)
+YABIL_MATH_EXPORT yabil::bigint::BigInt root(const yabil::bigint::BigInt &n, uint64_t k);
+
+/// @brief Calculate k-th root of given \p BigInt together with the remainder
+/// @details Newton iteration is seeded from the root of top bits of \p n, which doubles precision at every level.
+/// @param n Number to calculate root of
+/// @param k Degree of root to calculate
+/// @return \p std::pair<BigInt,BigInt> of s = floor(root(n, k)) and remainder n - s^k
+YABIL_MATH_EXPORT std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt> rootrem(const yabil::bigint::BigInt &n,
+                                                                                  uint64_t k);
+
+/// @brief Check if given \p BigInt is a perfect power, i.e. n = a^b for some integers a and b > 1
+/// @details Only prime exponents up to log2(n) are tested, most of them are rejected by residues modulo small primes.
+/// @param n Number to check
+/// @return True if \p n is a perfect power (0, 1 and -1 are considered perfect powers)
+YABIL_MATH_EXPORT bool is_perfect_power(const yabil::bigint::BigInt &n);
+
 }  // namespace yabil::math
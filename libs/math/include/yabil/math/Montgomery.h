@@ -0,0 +1,80 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/math_export.h>
+
+namespace yabil::math
+{
+
+/// @brief Precomputed modulus data for modular multiplication with Montgomery reduction.
+/// @details Numbers in Montgomery form are stored as x * R mod n, where R = 2^(k * w), k is the digit count of
+/// the modulus and w is the bit width of single digit. Multiplication in this form needs no division,
+/// so single context can be reused for any number of operations with the same modulus.
+class MontgomeryContext
+{
+private:
+    yabil::bigint::BigInt n;
+    yabil::bigint::BigInt n_inverse;
+    yabil::bigint::BigInt r_mod_n;
+    yabil::bigint::BigInt r_squared;
+    yabil::bigint::bigint_base_t n_prime = 0;
+
+public:
+    /// @brief Create context for given modulus.
+    /// @param modulus Odd modulus greater than 1
+    /// @throws std::invalid_argument when modulus is even or not greater than 1
+    YABIL_MATH_EXPORT explicit MontgomeryContext(const yabil::bigint::BigInt &modulus);
+
+    /// @brief Get modulus of the context.
+    /// @return \p BigInt modulus
+    YABIL_MATH_EXPORT const yabil::bigint::BigInt &modulus() const;
+
+    /// @brief Get representation of 1 in Montgomery form.
+    /// @return \p BigInt R mod n
+    YABIL_MATH_EXPORT const yabil::bigint::BigInt &one() const;
+
+    /// @brief Convert number to Montgomery form.
+    /// @param x Any \p BigInt number, it is reduced modulo n first
+    /// @return \p BigInt x * R mod n
+    YABIL_MATH_EXPORT yabil::bigint::BigInt to_montgomery(const yabil::bigint::BigInt &x) const;
+
+    /// @brief Convert number from Montgomery form.
+    /// @param x Number in range [0, n)
+    /// @return \p BigInt x * R^-1 mod n
+    YABIL_MATH_EXPORT yabil::bigint::BigInt from_montgomery(const yabil::bigint::BigInt &x) const;
+
+    /// @brief Montgomery multiplication.
+    /// @param a First number in range [0, n)
+    /// @param b Second number in range [0, n)
+    /// @return \p BigInt a * b * R^-1 mod n
+    YABIL_MATH_EXPORT yabil::bigint::BigInt multiply(const yabil::bigint::BigInt &a,
+                                                     const yabil::bigint::BigInt &b) const;
+
+    /// @brief Montgomery squaring.
+    /// @param a Number in range [0, n)
+    /// @return \p BigInt a * a * R^-1 mod n
+    YABIL_MATH_EXPORT yabil::bigint::BigInt square(const yabil::bigint::BigInt &a) const;
+
+    /// @brief Modular exponentiation in Montgomery form.
+    /// @details Uses sliding window exponentiation, window size grows with the length of the exponent.
+    /// @param base Number in Montgomery form in range [0, n)
+    /// @param exponent Non-negative exponent
+    /// @return \p BigInt base^exponent in Montgomery form
+    YABIL_MATH_EXPORT yabil::bigint::BigInt pow(const yabil::bigint::BigInt &base,
+                                                const yabil::bigint::BigInt &exponent) const;
+
+    /// @brief Modular exponentiation in Montgomery form in time independent of values of base and exponent.
+    /// @details Uses fixed window exponentiation on numbers padded to the length of the modulus. Every window takes
+    /// the same sequence of multiplications and reads the whole table of powers, so neither branches nor memory
+    /// accesses depend on the values. Number of operations depends only on digit counts of the modulus and exponent.
+    /// @param base Number in Montgomery form in range [0, n)
+    /// @param exponent Non-negative exponent
+    /// @return \p BigInt base^exponent in Montgomery form
+    YABIL_MATH_EXPORT yabil::bigint::BigInt pow_consttime(const yabil::bigint::BigInt &base,
+                                                          const yabil::bigint::BigInt &exponent) const;
+
+private:
+    yabil::bigint::BigInt reduce(const yabil::bigint::BigInt &t) const;
+};
+
+}  // namespace yabil::math
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/math_export.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace yabil::math::parallel
+{
+
+/// @brief Calculate factorial of the number n using multiple threads.
+/// @details Swing numbers of all recursion levels are computed concurrently on the thread pool.
+/// @param n Number to calculate factorial for
+/// @return \p BigInt result
+YABIL_MATH_EXPORT yabil::bigint::BigInt factorial(uint64_t n);
+
+/// @brief Calculate decimal digits of pi using multiple threads.
+/// @details Subranges of Chudnovsky series terms are summed concurrently on the thread pool.
+/// @param digits Number of digits after the decimal point
+/// @return \p BigInt floor(pi * 10^digits)
+YABIL_MATH_EXPORT yabil::bigint::BigInt pi(uint64_t digits);
+
+/// @brief Calculate decimal digits of Euler's number e using multiple threads.
+/// @details Subranges of the series terms are summed concurrently on the thread pool.
+/// @param digits Number of digits after the decimal point
+/// @return \p BigInt floor(e * 10^digits)
+YABIL_MATH_EXPORT yabil::bigint::BigInt e(uint64_t digits);
+
+/// @brief Calculate multiplicative inverses of all numbers modulo n using multiple threads.
+/// @details Prefix products of the batch are split into chunks computed concurrently on the thread pool.
+/// @throws std::runtime_error when any of the numbers is not invertible modulo \p n
+/// @param numbers Numbers to invert
+/// @param n \p BigInt Modulus
+/// @return \p std::vector<BigInt> inverses in the same order as \p numbers
+YABIL_MATH_EXPORT std::vector<yabil::bigint::BigInt> batch_mod_inverse(std::span<const yabil::bigint::BigInt> numbers,
+                                                                       const yabil::bigint::BigInt &n);
+
+}  // namespace yabil::math::parallel
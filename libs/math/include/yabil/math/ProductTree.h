@@ -0,0 +1,79 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/math_export.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace yabil::math
+{
+
+class ProductTree;
+
+namespace parallel
+{
+
+/// @brief Build product tree of given numbers using multiple threads.
+/// @details Multiplications of wide levels are split into chunks computed concurrently on the thread pool.
+/// @param numbers Positive numbers to become leaves of the tree
+/// @return \p ProductTree of the numbers
+YABIL_MATH_EXPORT ProductTree product_tree(std::span<const yabil::bigint::BigInt> numbers);
+
+/// @brief Reduce number modulo all leaves of the tree using multiple threads.
+/// @param tree Product tree of moduli
+/// @param x Number to reduce
+/// @return \p std::vector<BigInt> of x mod leaf (in range [0, leaf)) in the same order as leaves
+YABIL_MATH_EXPORT std::vector<yabil::bigint::BigInt> remainder_tree(const ProductTree &tree,
+                                                                    const yabil::bigint::BigInt &x);
+
+}  // namespace parallel
+
+/// @brief Balanced binary tree of products of given numbers.
+/// @details Leaves of the tree are the given numbers and every node is the product of its children, so operands
+/// of every multiplication have similar size. Tree is built once and can be reused for any number of multipoint
+/// operations like simultaneous reduction of a number modulo all of the leaves.
+class ProductTree
+{
+private:
+    std::vector<std::vector<yabil::bigint::BigInt>> levels;
+
+public:
+    /// @brief Build product tree of given numbers.
+    /// @param numbers Positive numbers to become leaves of the tree
+    YABIL_MATH_EXPORT explicit ProductTree(std::span<const yabil::bigint::BigInt> numbers);
+
+    /// @brief Get product of all leaves (root of the tree).
+    /// @return \p BigInt product, 1 for tree without leaves
+    YABIL_MATH_EXPORT const yabil::bigint::BigInt &product() const;
+
+    /// @brief Get number of leaves.
+    /// @return Number of numbers the tree was built from
+    YABIL_MATH_EXPORT std::size_t size() const;
+
+    /// @brief Get number of tree levels.
+    /// @return Number of levels, including leaves and root
+    YABIL_MATH_EXPORT std::size_t height() const;
+
+    /// @brief Get nodes of the tree level.
+    /// @details Level 0 contains leaves. Node j of level i + 1 is the product of nodes 2j and 2j + 1 of level i
+    /// (the last node of a level with odd size is moved up unchanged).
+    /// @param index Level index in range [0, height())
+    /// @return \p std::vector<BigInt> nodes of the level
+    YABIL_MATH_EXPORT const std::vector<yabil::bigint::BigInt> &level(std::size_t index) const;
+
+    /// @brief Reduce number modulo all leaves of the tree.
+    /// @details Number is reduced modulo the root and then modulo the nodes on the way down, which takes
+    /// quasi-linear time instead of dividing full number by every leaf.
+    /// @param x Number to reduce
+    /// @return \p std::vector<BigInt> of x mod leaf (in range [0, leaf)) in the same order as leaves
+    YABIL_MATH_EXPORT std::vector<yabil::bigint::BigInt> remainder_tree(const yabil::bigint::BigInt &x) const;
+
+private:
+    explicit ProductTree(std::vector<std::vector<yabil::bigint::BigInt>> levels);
+
+    friend ProductTree parallel::product_tree(std::span<const yabil::bigint::BigInt> numbers);
+};
+
+}  // namespace yabil::math
@@ -0,0 +1,55 @@
+#include "Barrett.h"
+
+#include <yabil/bigint/BigInt.h>
+
+#include <stdexcept>
+
+namespace yabil::math
+{
+
+namespace
+{
+
+constexpr std::size_t digit_bits = bigint::bigint_base_t_size_bits;
+
+}  // namespace
+
+BarrettContext::BarrettContext(const bigint::BigInt &modulus) : n(modulus), k(modulus.raw_data().size())
+{
+    if (n.is_negative() || n.is_zero())
+    {
+        throw std::invalid_argument("Barrett modulus must be positive");
+    }
+
+    // mu = floor(B^2k / n), where B is the digit base
+    mu = (bigint::BigInt(1) << (2 * k * digit_bits)) / n;
+}
+
+const bigint::BigInt &BarrettContext::modulus() const
+{
+    return n;
+}
+
+bigint::BigInt BarrettContext::reduce(const bigint::BigInt &x) const
+{
+    // Quotient estimate is lower than the real quotient by at most 2
+    const auto q = ((x >> ((k - 1) * digit_bits)) * mu) >> ((k + 1) * digit_bits);
+    auto r = x - q * n;
+    while (r >= n)
+    {
+        r -= n;
+    }
+    return r;
+}
+
+bigint::BigInt BarrettContext::multiply(const bigint::BigInt &a, const bigint::BigInt &b) const
+{
+    return reduce(a * b);
+}
+
+bigint::BigInt BarrettContext::square(const bigint::BigInt &a) const
+{
+    return reduce(a * a);
+}
+
+}  // namespace yabil::math
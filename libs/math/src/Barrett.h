@@ -0,0 +1,36 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+
+#include <cstddef>
+
+namespace yabil::math
+{
+
+/// Modular multiplication with Barrett reduction, used for moduli which have no Montgomery form (even ones).
+/// Numbers are kept in ordinary form, reduction needs two multiplications by precomputed reciprocal instead of
+/// a division.
+class BarrettContext
+{
+private:
+    bigint::BigInt n;
+    bigint::BigInt mu;
+    std::size_t k;
+
+public:
+    /// Modulus must be positive.
+    explicit BarrettContext(const bigint::BigInt &modulus);
+
+    const bigint::BigInt &modulus() const;
+
+    /// Reduce number x in range [0, n^2).
+    bigint::BigInt reduce(const bigint::BigInt &x) const;
+
+    /// Multiply numbers in range [0, n).
+    bigint::BigInt multiply(const bigint::BigInt &a, const bigint::BigInt &b) const;
+
+    /// Square number in range [0, n).
+    bigint::BigInt square(const bigint::BigInt &a) const;
+};
+
+}  // namespace yabil::math
@@ -0,0 +1,218 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
+#include <yabil/math/Parallel.h>
+#include <yabil/utils/ThreadPoolSingleton.h>
+
+#include <algorithm>
+#include <future>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Barrett.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+// Minimal number of elements processed by single task of parallel batch inversion
+constexpr std::size_t parallel_batch_inverse_min_chunk = 32;
+
+[[noreturn]] void throw_not_invertible(const bigint::BigInt &number)
+{
+    throw std::runtime_error("number: " + number.to_str() + " is not invertible");
+}
+
+std::vector<bigint::BigInt> reduce_all(std::span<const bigint::BigInt> numbers, const bigint::BigInt &n)
+{
+    std::vector<bigint::BigInt> values;
+    values.reserve(numbers.size());
+
+    for (const auto &number : numbers)
+    {
+        if (number.is_negative() || number >= n)
+        {
+            auto reduced = number % n;
+            values.push_back(reduced.is_negative() ? reduced + n : std::move(reduced));
+        }
+        else
+        {
+            values.push_back(number);
+        }
+
+        if (values.back().is_zero())
+        {
+            throw_not_invertible(number);
+        }
+    }
+    return values;
+}
+
+/// Fill products with prefix products of values (multiplied with context).
+template <typename Context>
+void prefix_products(const Context &context, std::span<const bigint::BigInt> values, std::span<bigint::BigInt> products)
+{
+    products[0] = values[0];
+    for (std::size_t i = 1; i < values.size(); ++i)
+    {
+        products[i] = context.multiply(products[i - 1], values[i]);
+    }
+}
+
+/// Replace prefix products with inverses of values, starting from the inverse of the last product.
+template <typename Context>
+void inverses_from_products(const Context &context, std::span<const bigint::BigInt> values,
+                            std::span<bigint::BigInt> products, bigint::BigInt inverse)
+{
+    for (std::size_t i = values.size() - 1; i > 0; --i)
+    {
+        products[i] = context.multiply(inverse, products[i - 1]);
+        inverse = context.multiply(inverse, values[i]);
+    }
+    products[0] = std::move(inverse);
+}
+
+/// Invert product of all values. When it is not invertible, report the first of the numbers causing it.
+bigint::BigInt invert_product(const bigint::BigInt &product, std::span<const bigint::BigInt> values,
+                              std::span<const bigint::BigInt> numbers, const bigint::BigInt &n)
+{
+    try
+    {
+        return mod_inverse(product, n);
+    }
+    catch (const std::runtime_error &)
+    {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            if (gcd(values[i], n) != bigint::BigInt(1))
+            {
+                throw_not_invertible(numbers[i]);
+            }
+        }
+        throw;
+    }
+}
+
+template <typename Context>
+std::vector<bigint::BigInt> batch_inverse(const Context &context, std::span<const bigint::BigInt> numbers,
+                                          const bigint::BigInt &n)
+{
+    const auto values = reduce_all(numbers, n);
+    std::vector<bigint::BigInt> result(values.size());
+
+    prefix_products<Context>(context, values, result);
+    inverses_from_products<Context>(context, values, result, invert_product(result.back(), values, numbers, n));
+    return result;
+}
+
+template <typename Context>
+std::vector<bigint::BigInt> parallel_batch_inverse(const Context &context, std::span<const bigint::BigInt> numbers,
+                                                   const bigint::BigInt &n, std::size_t chunks)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    const auto values = reduce_all(numbers, n);
+    std::vector<bigint::BigInt> result(values.size());
+
+    const auto chunk_begin = [&](std::size_t chunk) { return chunk * values.size() / chunks; };
+    const auto values_chunk = [&](std::size_t chunk)
+    {
+        return std::span<const bigint::BigInt>(values).subspan(chunk_begin(chunk),
+                                                                chunk_begin(chunk + 1) - chunk_begin(chunk));
+    };
+    const auto result_chunk = [&](std::size_t chunk)
+    {
+        return std::span<bigint::BigInt>(result).subspan(chunk_begin(chunk),
+                                                         chunk_begin(chunk + 1) - chunk_begin(chunk));
+    };
+
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(chunks);
+
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        tasks.push_back(thread_pool.submit([&, i]()
+                                           { prefix_products<Context>(context, values_chunk(i), result_chunk(i)); }));
+    }
+
+    std::vector<bigint::BigInt> chunk_products;
+    chunk_products.reserve(chunks);
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        tasks[i].get();
+        chunk_products.push_back(result_chunk(i).back());
+    }
+
+    // Inverses of the chunk products are the starting points for inverting every chunk
+    std::vector<bigint::BigInt> chunk_inverses(chunks);
+    prefix_products<Context>(context, chunk_products, chunk_inverses);
+    inverses_from_products<Context>(context, chunk_products, chunk_inverses,
+                                    invert_product(chunk_inverses.back(), values, numbers, n));
+
+    tasks.clear();
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        tasks.push_back(thread_pool.submit(
+            [&, i]()
+            { inverses_from_products<Context>(context, values_chunk(i), result_chunk(i), chunk_inverses[i]); }));
+    }
+
+    for (auto &task : tasks)
+    {
+        task.get();
+    }
+    return result;
+}
+
+/// Call function with the fastest multiplication context available for modulus.
+template <typename Function>
+std::vector<bigint::BigInt> with_context(const bigint::BigInt &n, Function function)
+{
+    if (n.is_even())
+    {
+        return function(BarrettContext(n));
+    }
+    return function(MontgomeryContext(n));
+}
+
+}  // namespace
+
+std::vector<yabil::bigint::BigInt> batch_mod_inverse(std::span<const yabil::bigint::BigInt> numbers,
+                                                     const yabil::bigint::BigInt &n)
+{
+    if (n.is_negative() || n.is_zero())
+    {
+        throw std::invalid_argument("Modulus must be positive");
+    }
+
+    if (numbers.empty() || n == yabil::bigint::BigInt(1))
+    {
+        return std::vector<yabil::bigint::BigInt>(numbers.size());
+    }
+
+    return with_context(n, [&](const auto &context) { return batch_inverse(context, numbers, n); });
+}
+
+namespace parallel
+{
+
+std::vector<yabil::bigint::BigInt> batch_mod_inverse(std::span<const yabil::bigint::BigInt> numbers,
+                                                     const yabil::bigint::BigInt &n)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    const auto chunks = std::min(thread_pool.thread_count(), numbers.size() / parallel_batch_inverse_min_chunk);
+
+    if (chunks == 0 || thread_pool.is_current_thread_worker() || n.is_negative() || n <= yabil::bigint::BigInt(1))
+    {
+        return math::batch_mod_inverse(numbers, n);
+    }
+
+    return with_context(n, [&](const auto &context) { return parallel_batch_inverse(context, numbers, n, chunks); });
+}
+
+}  // namespace parallel
+
+}  // namespace yabil::math
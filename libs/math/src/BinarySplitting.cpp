@@ -0,0 +1,94 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/BinarySplitting.h>
+#include <yabil/utils/ThreadPoolSingleton.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace yabil::math
+{
+
+namespace
+{
+
+// Minimal number of terms summed by single task of parallel binary splitting
+constexpr uint64_t parallel_binary_splitting_min_chunk = 64;
+
+BinarySplittingResult combine(const BinarySplittingResult &left, const BinarySplittingResult &right)
+{
+    return {left.P * right.P, left.Q * right.Q, left.T * right.Q + left.P * right.T};
+}
+
+/// Combine results of consecutive ranges, pairing neighbours so that operands stay balanced.
+BinarySplittingResult combine_all(std::span<const BinarySplittingResult> results)
+{
+    if (results.size() == 1)
+    {
+        return results.front();
+    }
+
+    const std::size_t middle = results.size() / 2;
+    return combine(combine_all(results.first(middle)), combine_all(results.subspan(middle)));
+}
+
+}  // namespace
+
+BinarySplittingResult binary_splitting(const HypergeometricSeries &series, uint64_t begin, uint64_t end)
+{
+    if (end <= begin)
+    {
+        return {bigint::BigInt(1), bigint::BigInt(1), bigint::BigInt()};
+    }
+
+    if (end - begin == 1)
+    {
+        auto p = series.p(begin);
+        auto T = series.a(begin) * p;
+        return {std::move(p), series.q(begin), std::move(T)};
+    }
+
+    const uint64_t middle = begin + (end - begin) / 2;
+    return combine(binary_splitting(series, begin, middle), binary_splitting(series, middle, end));
+}
+
+namespace parallel
+{
+
+BinarySplittingResult binary_splitting(const HypergeometricSeries &series, uint64_t begin, uint64_t end)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    const uint64_t terms = end > begin ? end - begin : 0;
+    const auto chunks = std::min<uint64_t>(thread_pool.thread_count(), terms / parallel_binary_splitting_min_chunk);
+
+    if (chunks < 2 || thread_pool.is_current_thread_worker())
+    {
+        return math::binary_splitting(series, begin, end);
+    }
+
+    std::vector<std::future<BinarySplittingResult>> partial_results;
+    partial_results.reserve(chunks);
+
+    for (uint64_t i = 0; i < chunks; ++i)
+    {
+        const uint64_t chunk_begin = begin + i * terms / chunks;
+        const uint64_t chunk_end = begin + (i + 1) * terms / chunks;
+        partial_results.push_back(thread_pool.submit(
+            [&series, chunk_begin, chunk_end]() { return math::binary_splitting(series, chunk_begin, chunk_end); }));
+    }
+
+    std::vector<BinarySplittingResult> results;
+    results.reserve(chunks);
+    for (auto &partial_result : partial_results)
+    {
+        results.push_back(partial_result.get());
+    }
+    return combine_all(results);
+}
+
+}  // namespace parallel
+
+}  // namespace yabil::math
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+namespace yabil::math
+{
+
+/// Number of significant bits of number stored in little-endian digits, 0 for zero.
+inline std::size_t bit_length(const std::vector<bigint::bigint_base_t> &digits)
+{
+    if (digits.empty())
+    {
+        return 0;
+    }
+    const auto leading_zeros = static_cast<std::size_t>(std::countl_zero(digits.back()));
+    return digits.size() * bigint::bigint_base_t_size_bits - leading_zeros;
+}
+
+/// Number of significant bits of absolute value of x.
+inline std::size_t bit_length(const bigint::BigInt &x)
+{
+    return bit_length(x.raw_data());
+}
+
+/// Number of trailing zero bits of number stored in little-endian digits, number of all bits for zero.
+inline std::size_t trailing_zeros(const std::vector<bigint::bigint_base_t> &digits)
+{
+    std::size_t zeros = 0;
+    for (const auto digit : digits)
+    {
+        if (digit != 0)
+        {
+            return zeros + static_cast<std::size_t>(std::countr_zero(digit));
+        }
+        zeros += bigint::bigint_base_t_size_bits;
+    }
+    return zeros;
+}
+
+/// Number of trailing zero bits of absolute value of x.
+inline std::size_t trailing_zeros(const bigint::BigInt &x)
+{
+    return trailing_zeros(x.raw_data());
+}
+
+/// Remove leading zero digits of number stored in little-endian digits.
+inline void trim(std::vector<bigint::bigint_base_t> &digits)
+{
+    while (!digits.empty() && digits.back() == 0)
+    {
+        digits.pop_back();
+    }
+}
+
+}  // namespace yabil::math
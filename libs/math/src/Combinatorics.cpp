@@ -0,0 +1,166 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "Primes.h"
+#include "Product.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+// Sieving primes up to n costs about as much as the product of k factors (n - k, n] divided by k! when
+// n = falling_product_cost_factor * k^1.5, smaller k are computed with the latter
+constexpr double falling_product_cost_factor = 4;
+
+bool use_falling_product(uint64_t n, uint64_t k)
+{
+    const auto k_double = static_cast<double>(k);
+    return falling_product_cost_factor * k_double * std::sqrt(k_double) < static_cast<double>(n);
+}
+
+/// Product of factors (n - k, n].
+yabil::bigint::BigInt falling_product(uint64_t n, uint64_t k)
+{
+    std::vector<uint64_t> factors;
+    factors.reserve(k);
+    for (uint64_t i = 0; i < k; ++i)
+    {
+        factors.push_back(n - i);
+    }
+    return product(factors);
+}
+
+/// Exponent of prime p in n! (Legendre's formula).
+uint64_t legendre_exponent(uint64_t n, uint64_t p)
+{
+    uint64_t exponent = 0;
+    for (; n > 0; n /= p)
+    {
+        exponent += n / p;
+    }
+    return exponent;
+}
+
+/// Append p^exponent to factors, split into powers fitting into 64 bits.
+void append_prime_power(std::vector<uint64_t> &factors, uint64_t p, uint64_t exponent)
+{
+    uint64_t power = 1;
+    for (; exponent > 0; --exponent)
+    {
+        if (power > std::numeric_limits<uint64_t>::max() / p)
+        {
+            factors.push_back(power);
+            power = 1;
+        }
+        power *= p;
+    }
+
+    if (power > 1)
+    {
+        factors.push_back(power);
+    }
+}
+
+}  // namespace
+
+yabil::bigint::BigInt binomial(uint64_t n, uint64_t k)
+{
+    if (k > n)
+    {
+        return yabil::bigint::BigInt();
+    }
+
+    k = std::min(k, n - k);
+    if (use_falling_product(n, k))
+    {
+        return falling_product(n, k).divexact(factorial(k));
+    }
+
+    // Exponent of p is the number of carries when adding k and n - k in base p (Kummer's theorem)
+    std::vector<uint64_t> factors;
+    for (const auto p : primes_up_to(n))
+    {
+        append_prime_power(factors, p,
+                           legendre_exponent(n, p) - legendre_exponent(k, p) - legendre_exponent(n - k, p));
+    }
+    return product(factors);
+}
+
+yabil::bigint::BigInt multinomial(std::span<const uint64_t> k)
+{
+    uint64_t n = 0;
+    for (const auto k_i : k)
+    {
+        if (k_i > std::numeric_limits<uint64_t>::max() - n)
+        {
+            throw std::invalid_argument("Sum of multinomial coefficient arguments is too big");
+        }
+        n += k_i;
+    }
+
+    // With one dominating part the coefficient is (n - m, n] / product of factorials of the other parts
+    const auto largest = std::max_element(k.begin(), k.end());
+    const uint64_t rest = largest == k.end() ? 0 : n - *largest;
+    if (use_falling_product(n, rest))
+    {
+        std::vector<yabil::bigint::BigInt> factorials;
+        for (auto it = k.begin(); it != k.end(); ++it)
+        {
+            if (it != largest && *it > 1)
+            {
+                factorials.push_back(factorial(*it));
+            }
+        }
+        return falling_product(n, rest).divexact(product(factorials));
+    }
+
+    std::vector<uint64_t> factors;
+    for (const auto p : primes_up_to(n))
+    {
+        uint64_t exponent = legendre_exponent(n, p);
+        for (const auto k_i : k)
+        {
+            exponent -= legendre_exponent(k_i, p);
+        }
+        append_prime_power(factors, p, exponent);
+    }
+    return product(factors);
+}
+
+yabil::bigint::BigInt primorial(uint64_t n)
+{
+    return product(primes_up_to(n));
+}
+
+yabil::bigint::BigInt double_factorial(uint64_t n)
+{
+    // (2m)!! = 2^m * m!
+    if (n % 2 == 0)
+    {
+        return factorial(n / 2) << (n / 2);
+    }
+
+    // (2m + 1)!! = (2m + 1)! / (2^m * m!), so exponent of odd prime p is the difference of Legendre's exponents
+    const uint64_t m = n / 2;
+    std::vector<uint64_t> factors;
+    for (const auto p : primes_up_to(n))
+    {
+        if (p != 2)
+        {
+            append_prime_power(factors, p, legendre_exponent(n, p) - legendre_exponent(m, p));
+        }
+    }
+    return product(factors);
+}
+
+}  // namespace yabil::math
@@ -0,0 +1,106 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/BinarySplitting.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Parallel.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace yabil::math
+{
+
+namespace
+{
+
+// Every term of Chudnovsky series adds about 14.18 decimal digits
+constexpr double chudnovsky_digits_per_term = 14.181647462725477;
+
+// Additional digits calculated to avoid rounding errors in the last digits of the result
+constexpr uint64_t guard_digits = 10;
+
+/// Chudnovsky series: sum((-1)^k * (6k)! * (A + Bk) / ((3k)! * (k!)^3 * C^3k)) = C^(3/2) / (12 * pi).
+HypergeometricSeries chudnovsky_series()
+{
+    // C^3 / 24 for C = 640320
+    constexpr uint64_t c3_over_24 = 10939058860032000ULL;
+
+    return {[](uint64_t k)
+            {
+                if (k == 0) return bigint::BigInt(1);
+                return -(bigint::BigInt(6 * k - 5) * bigint::BigInt(2 * k - 1) * bigint::BigInt(6 * k - 1));
+            },
+            [](uint64_t k)
+            {
+                if (k == 0) return bigint::BigInt(1);
+                return bigint::BigInt(k) * bigint::BigInt(k) * bigint::BigInt(k) * bigint::BigInt(c3_over_24);
+            },
+            [](uint64_t k) { return bigint::BigInt(13591409) + bigint::BigInt(545140134) * bigint::BigInt(k); }};
+}
+
+/// Series sum(1 / k!) = e.
+HypergeometricSeries e_series()
+{
+    return {[](uint64_t) { return bigint::BigInt(1); },
+            [](uint64_t k) { return bigint::BigInt(k == 0 ? 1 : k); },
+            [](uint64_t) { return bigint::BigInt(1); }};
+}
+
+uint64_t chudnovsky_terms(uint64_t digits)
+{
+    return static_cast<uint64_t>(static_cast<double>(digits + guard_digits) / chudnovsky_digits_per_term) + 1;
+}
+
+/// Get number of terms n, such that 1 / n! < 10^-(digits + guard_digits).
+uint64_t e_terms(uint64_t digits)
+{
+    uint64_t terms = 1;
+    for (double factorial_digits = 0; factorial_digits <= static_cast<double>(digits + guard_digits); ++terms)
+    {
+        factorial_digits += std::log10(static_cast<double>(terms));
+    }
+    return terms;
+}
+
+/// pi * 10^digits = 426880 * sqrt(10005) * Q / T
+yabil::bigint::BigInt pi_from_series(const BinarySplittingResult &sum, uint64_t digits)
+{
+    const auto scale = pow(yabil::bigint::BigInt(10), yabil::bigint::BigInt(digits + guard_digits));
+    const auto scaled_sqrt = sqrt(yabil::bigint::BigInt(10005) * scale * scale);
+    const auto pi_with_guard_digits = yabil::bigint::BigInt(426880) * scaled_sqrt * sum.Q / sum.T;
+    return pi_with_guard_digits / pow(yabil::bigint::BigInt(10), yabil::bigint::BigInt(guard_digits));
+}
+
+/// e * 10^digits = T * 10^digits / Q
+yabil::bigint::BigInt e_from_series(const BinarySplittingResult &sum, uint64_t digits)
+{
+    return sum.T * pow(yabil::bigint::BigInt(10), yabil::bigint::BigInt(digits)) / sum.Q;
+}
+
+}  // namespace
+
+yabil::bigint::BigInt pi(uint64_t digits)
+{
+    return pi_from_series(binary_splitting(chudnovsky_series(), 0, chudnovsky_terms(digits)), digits);
+}
+
+yabil::bigint::BigInt e(uint64_t digits)
+{
+    return e_from_series(binary_splitting(e_series(), 0, e_terms(digits)), digits);
+}
+
+namespace parallel
+{
+
+yabil::bigint::BigInt pi(uint64_t digits)
+{
+    return pi_from_series(parallel::binary_splitting(chudnovsky_series(), 0, chudnovsky_terms(digits)), digits);
+}
+
+yabil::bigint::BigInt e(uint64_t digits)
+{
+    return e_from_series(parallel::binary_splitting(e_series(), 0, e_terms(digits)), digits);
+}
+
+}  // namespace parallel
+
+}  // namespace yabil::math
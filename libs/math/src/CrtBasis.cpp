@@ -0,0 +1,157 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/CrtBasis.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/ProductTree.h>
+
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace yabil::math
+{
+
+namespace
+{
+
+bigint::BigInt reduce(const bigint::BigInt &x, const bigint::BigInt &n)
+{
+    if (!x.is_negative() && x < n)
+    {
+        return x;
+    }
+
+    auto remainder = x % n;
+    return remainder.is_negative() ? remainder + n : remainder;
+}
+
+const ProductTree &validated(const ProductTree &tree)
+{
+    for (const auto &modulus : tree.level(0))
+    {
+        if (modulus.is_negative() || modulus.is_zero())
+        {
+            throw std::invalid_argument("CRT moduli must be positive");
+        }
+    }
+    return tree;
+}
+
+/// Calculate (M / m_i) mod m_i for all leaves of the tree, going down from the root.
+/// Cofactor of the node is the cofactor of its parent multiplied by its sibling.
+std::vector<bigint::BigInt> leaf_cofactors(const ProductTree &tree)
+{
+    std::vector<bigint::BigInt> cofactors{reduce(bigint::BigInt(1), tree.product())};
+
+    for (std::size_t i = tree.height() - 1; i > 0; --i)
+    {
+        const auto &nodes = tree.level(i - 1);
+        std::vector<bigint::BigInt> lower_cofactors(nodes.size());
+
+        for (std::size_t j = 0; j < nodes.size(); ++j)
+        {
+            const std::size_t sibling = j ^ 1;
+            auto cofactor = reduce(cofactors[j / 2], nodes[j]);
+            if (sibling < nodes.size())
+            {
+                cofactor = reduce(cofactor * reduce(nodes[sibling], nodes[j]), nodes[j]);
+            }
+            lower_cofactors[j] = std::move(cofactor);
+        }
+        cofactors = std::move(lower_cofactors);
+    }
+    return cofactors;
+}
+
+std::vector<bigint::BigInt> cofactor_inverses_of(const ProductTree &tree)
+{
+    if (tree.size() == 0)
+    {
+        return {};
+    }
+
+    auto inverses = leaf_cofactors(tree);
+    for (std::size_t i = 0; i < inverses.size(); ++i)
+    {
+        try
+        {
+            inverses[i] = mod_inverse(inverses[i], tree.level(0)[i]);
+        }
+        catch (const std::runtime_error &)
+        {
+            throw std::invalid_argument("CRT moduli must be pairwise coprime");
+        }
+    }
+    return inverses;
+}
+
+}  // namespace
+
+CrtBasis::CrtBasis(std::span<const yabil::bigint::BigInt> moduli)
+    : moduli_tree(moduli), cofactor_inverses(cofactor_inverses_of(validated(moduli_tree)))
+{
+}
+
+const yabil::bigint::BigInt &CrtBasis::modulus() const
+{
+    return moduli_tree.product();
+}
+
+const std::vector<yabil::bigint::BigInt> &CrtBasis::moduli() const
+{
+    return moduli_tree.level(0);
+}
+
+std::size_t CrtBasis::size() const
+{
+    return moduli_tree.size();
+}
+
+const ProductTree &CrtBasis::tree() const
+{
+    return moduli_tree;
+}
+
+const std::vector<yabil::bigint::BigInt> &CrtBasis::inverses() const
+{
+    return cofactor_inverses;
+}
+
+yabil::bigint::BigInt crt(std::span<const yabil::bigint::BigInt> residues, const CrtBasis &basis)
+{
+    if (residues.size() != basis.size())
+    {
+        throw std::invalid_argument("Number of residues must be equal to number of CRT moduli");
+    }
+
+    if (residues.empty())
+    {
+        return yabil::bigint::BigInt();
+    }
+
+    // Value of every node is sum of (r_i * c_i mod m_i) * (node / m_i) over its leaves
+    const auto &tree = basis.tree();
+    std::vector<yabil::bigint::BigInt> values(residues.size());
+    for (std::size_t i = 0; i < residues.size(); ++i)
+    {
+        const auto &modulus = basis.moduli()[i];
+        values[i] = reduce(reduce(residues[i], modulus) * basis.inverses()[i], modulus);
+    }
+
+    for (std::size_t i = 0; i + 1 < tree.height(); ++i)
+    {
+        const auto &nodes = tree.level(i);
+        std::vector<yabil::bigint::BigInt> upper_values((nodes.size() + 1) / 2);
+
+        for (std::size_t j = 0; j < upper_values.size(); ++j)
+        {
+            upper_values[j] = 2 * j + 1 < nodes.size()
+                                  ? values[2 * j] * nodes[2 * j + 1] + values[2 * j + 1] * nodes[2 * j]
+                                  : std::move(values[2 * j]);
+        }
+        values = std::move(upper_values);
+    }
+    return reduce(values.front(), basis.modulus());
+}
+
+}  // namespace yabil::math
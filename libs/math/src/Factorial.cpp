@@ -0,0 +1,124 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Parallel.h>
+#include <yabil/utils/ThreadPoolSingleton.h>
+
+#include <bit>
+#include <cstdint>
+#include <future>
+#include <span>
+#include <vector>
+
+#include "Primes.h"
+#include "Product.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+/// Get prime powers composing odd part of the swing number n! / ((n/2)!)^2 (Luschny's prime swing).
+/// Exponent of prime p is equal to the number of odd values of n / p^i for i >= 1.
+std::vector<uint64_t> odd_swing_factors(uint64_t n, std::span<const uint64_t> odd_primes)
+{
+    std::vector<uint64_t> factors;
+    for (const auto p : odd_primes)
+    {
+        if (p > n) break;
+
+        uint64_t power = 1;
+        for (uint64_t q = n / p; q > 0; q /= p)
+        {
+            if (q & 1) power *= p;
+        }
+
+        if (power > 1) factors.push_back(power);
+    }
+    return factors;
+}
+
+std::vector<uint64_t> odd_primes_up_to(uint64_t n)
+{
+    auto primes = primes_up_to(n);
+    if (!primes.empty())
+    {
+        primes.erase(primes.begin());
+    }
+    return primes;
+}
+
+/// Arguments of consecutive swing numbers: n, n/2, n/4, ... (only values with nontrivial odd swing).
+std::vector<uint64_t> swing_levels(uint64_t n)
+{
+    std::vector<uint64_t> levels;
+    for (; n >= 3; n /= 2)
+    {
+        levels.push_back(n);
+    }
+    return levels;
+}
+
+/// Combine odd swings of all levels: odd(n!) = odd((n/2)!)^2 * odd_swing(n), and restore power of 2.
+yabil::bigint::BigInt combine_swings(uint64_t n, std::vector<yabil::bigint::BigInt> swings)
+{
+    yabil::bigint::BigInt odd_part(1);
+    for (auto swing = swings.rbegin(); swing != swings.rend(); ++swing)
+    {
+        odd_part = odd_part * odd_part * *swing;
+    }
+    return odd_part << (n - static_cast<uint64_t>(std::popcount(n)));
+}
+
+}  // namespace
+
+yabil::bigint::BigInt factorial(uint64_t n)
+{
+    const auto odd_primes = odd_primes_up_to(n);
+    std::vector<yabil::bigint::BigInt> swings;
+
+    for (const auto level : swing_levels(n))
+    {
+        swings.push_back(product(odd_swing_factors(level, odd_primes)));
+    }
+    return combine_swings(n, std::move(swings));
+}
+
+namespace parallel
+{
+
+yabil::bigint::BigInt factorial(uint64_t n)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    if (thread_pool.is_current_thread_worker())
+    {
+        return math::factorial(n);
+    }
+
+    const auto odd_primes = odd_primes_up_to(n);
+    const auto levels = swing_levels(n);
+    if (levels.empty())
+    {
+        return combine_swings(n, {});
+    }
+
+    // Lower levels are independent tasks, the largest one is split across the pool
+    std::vector<std::future<yabil::bigint::BigInt>> lower_swings;
+    for (std::size_t i = 1; i < levels.size(); ++i)
+    {
+        lower_swings.push_back(thread_pool.submit([&odd_primes, level = levels[i]]()
+                                                  { return product(odd_swing_factors(level, odd_primes)); }));
+    }
+
+    std::vector<yabil::bigint::BigInt> swings;
+    swings.push_back(parallel_product(odd_swing_factors(levels.front(), odd_primes)));
+    for (auto &swing : lower_swings)
+    {
+        swings.push_back(swing.get());
+    }
+    return combine_swings(n, std::move(swings));
+}
+
+}  // namespace parallel
+
+}  // namespace yabil::math
@@ -0,0 +1,164 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "Barrett.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+/// Get (F(n), F(n - 1)) for n >= 1 with fast doubling, which needs two squarings per bit of n:
+/// F(2k + 1) = 4F(k)^2 - F(k - 1)^2 + 2(-1)^k, F(2k - 1) = F(k)^2 + F(k - 1)^2, F(2k) = F(2k + 1) - F(2k - 1).
+std::pair<bigint::BigInt, bigint::BigInt> fibonacci_pair(uint64_t n)
+{
+    bigint::BigInt f(1), f_previous(0);
+    bool k_odd = true;
+
+    for (int bit = 62 - std::countl_zero(n); bit >= 0; --bit)
+    {
+        const auto f_square = f * f;
+        const auto f_previous_square = f_previous * f_previous;
+
+        auto f_next = (f_square << 2) - f_previous_square + bigint::BigInt(k_odd ? -2 : 2);
+        auto f_double_previous = f_square + f_previous_square;
+        auto f_double = f_next - f_double_previous;
+
+        k_odd = (n >> bit) & 1;
+        if (k_odd)
+        {
+            f = std::move(f_next);
+            f_previous = std::move(f_double);
+        }
+        else
+        {
+            f = std::move(f_double);
+            f_previous = std::move(f_double_previous);
+        }
+    }
+    return {std::move(f), std::move(f_previous)};
+}
+
+bigint::BigInt to_context(const MontgomeryContext &context, const bigint::BigInt &x)
+{
+    return context.to_montgomery(x);
+}
+
+bigint::BigInt from_context(const MontgomeryContext &context, const bigint::BigInt &x)
+{
+    return context.from_montgomery(x);
+}
+
+bigint::BigInt to_context(const BarrettContext &context, const bigint::BigInt &x)
+{
+    auto reduced = x % context.modulus();
+    return reduced.is_negative() ? reduced + context.modulus() : reduced;
+}
+
+bigint::BigInt from_context(const BarrettContext &, const bigint::BigInt &x)
+{
+    return x;
+}
+
+/// Same fast doubling as fibonacci_pair, with all operations modulo context modulus.
+template <typename Context>
+bigint::BigInt fibonacci_mod(const Context &context, const bigint::BigInt &n)
+{
+    const auto &m = context.modulus();
+    const auto add = [&m](bigint::BigInt a, const bigint::BigInt &b)
+    {
+        a += b;
+        return a >= m ? a - m : a;
+    };
+    const auto sub = [&m](bigint::BigInt a, const bigint::BigInt &b)
+    {
+        a -= b;
+        return a.is_negative() ? a + m : a;
+    };
+
+    const auto two = to_context(context, bigint::BigInt(2));
+    auto f = to_context(context, bigint::BigInt(1));
+    auto f_previous = bigint::BigInt();
+    bool k_odd = true;
+
+    for (int64_t bit = static_cast<int64_t>(log2_int(n)) - 1; bit >= 0; --bit)
+    {
+        const auto f_square = context.square(f);
+        const auto f_previous_square = context.square(f_previous);
+
+        const auto f_square_times_4 = add(add(f_square, f_square), add(f_square, f_square));
+        const auto f_next_without_sign = sub(f_square_times_4, f_previous_square);
+        auto f_next = k_odd ? sub(f_next_without_sign, two) : add(f_next_without_sign, two);
+        auto f_double_previous = add(f_square, f_previous_square);
+        auto f_double = sub(f_next, f_double_previous);
+
+        k_odd = n.get_bit(static_cast<uint64_t>(bit));
+        if (k_odd)
+        {
+            f = std::move(f_next);
+            f_previous = std::move(f_double);
+        }
+        else
+        {
+            f = std::move(f_double);
+            f_previous = std::move(f_double_previous);
+        }
+    }
+    return from_context(context, f);
+}
+
+}  // namespace
+
+yabil::bigint::BigInt fibonacci(uint64_t n)
+{
+    if (n == 0)
+    {
+        return yabil::bigint::BigInt();
+    }
+    return fibonacci_pair(n).first;
+}
+
+yabil::bigint::BigInt lucas(uint64_t n)
+{
+    if (n == 0)
+    {
+        return yabil::bigint::BigInt(2);
+    }
+
+    // L(n) = F(n) + 2F(n - 1)
+    const auto [f, f_previous] = fibonacci_pair(n);
+    return f + (f_previous << 1);
+}
+
+yabil::bigint::BigInt fibonacci_mod(const yabil::bigint::BigInt &n, const yabil::bigint::BigInt &m)
+{
+    if (n.is_negative())
+    {
+        throw std::invalid_argument("Fibonacci number index must not be negative");
+    }
+
+    if (m.is_negative() || m.is_zero())
+    {
+        throw std::invalid_argument("Modulus must be positive");
+    }
+
+    if (n.is_zero() || m == yabil::bigint::BigInt(1))
+    {
+        return yabil::bigint::BigInt();
+    }
+
+    if (m.is_even())
+    {
+        return fibonacci_mod(BarrettContext(m), n);
+    }
+    return fibonacci_mod(MontgomeryContext(m), n);
+}
+
+}  // namespace yabil::math
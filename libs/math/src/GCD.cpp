@@ -0,0 +1,875 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/utils/TypeUtils.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Bits.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+using digit_t = bigint::bigint_base_t;
+using double_digit_t = utils::double_width_t<digit_t>;
+using digits_t = std::vector<digit_t>;
+
+constexpr std::size_t digit_bits = bigint::bigint_base_t_size_bits;
+
+// Number of leading bits used to compute quotient sequence in single Lehmer step
+constexpr std::size_t lehmer_bits = 2 * digit_bits - 1;
+
+// Numbers longer than this (in digits) are reduced with subquadratic half-gcd
+constexpr std::size_t hgcd_threshold_digits = 120;
+
+// Numbers not longer than this (in digits) are handled with binary gcd
+constexpr std::size_t binary_gcd_threshold_digits = 32;
+
+// Number of binary gcd steps computed on approximations before full numbers are updated
+constexpr std::size_t binary_batch_steps = digit_bits - 2;
+
+constexpr digit_t max_digit = std::numeric_limits<digit_t>::max();
+
+using signed_digit_t = std::make_signed_t<digit_t>;
+
+/// Cofactor matrix of consecutive Euclid steps. Only magnitudes are stored, signs of the entries
+/// are determined by the parity of the number of steps:
+/// even: [[a, -b], [-c, d]], odd: [[-a, b], [c, -d]].
+struct LehmerMatrix
+{
+    digit_t a = 1;
+    digit_t b = 0;
+    digit_t c = 0;
+    digit_t d = 1;
+    bool odd = false;
+};
+
+/// Cofactor matrix satisfying: (alpha; beta) = matrix * (a; b)
+struct CofactorMatrix
+{
+    bigint::BigInt m00{1}, m01{0}, m10{0}, m11{1};
+};
+
+/// Update factors of batched binary gcd: (a; b) <- (f0 * a + g0 * b; f1 * a + g1 * b) / 2^binary_batch_steps
+struct BinaryMatrix
+{
+    signed_digit_t f0 = 1;
+    signed_digit_t g0 = 0;
+    signed_digit_t f1 = 0;
+    signed_digit_t g1 = 1;
+};
+
+/// Magnitudes of the cofactors of the second input number tracked during Euclid steps:
+/// u = (-1)^odd * x0 * b (mod a), v = -(-1)^odd * x1 * b (mod a)
+struct SingleCofactor
+{
+    digits_t x0;
+    digits_t x1{1};
+    bool odd = true;
+};
+
+struct HalfGcdResult
+{
+    CofactorMatrix matrix;
+    bigint::BigInt alpha, beta;
+};
+
+bool abs_lower(const digits_t &a, const digits_t &b)
+{
+    return a.size() < b.size() ||
+           (a.size() == b.size() && std::lexicographical_compare(a.crbegin(), a.crend(), b.crbegin(), b.crend()));
+}
+
+double_digit_t to_double_digit(const digits_t &x)
+{
+    double_digit_t result = 0;
+    for (std::size_t i = 0; i < x.size() && i < 2; ++i)
+    {
+        result |= static_cast<double_digit_t>(x[i]) << (i * digit_bits);
+    }
+    return result;
+}
+
+digits_t from_double_digit(double_digit_t x)
+{
+    digits_t result{static_cast<digit_t>(x), static_cast<digit_t>(x >> digit_bits)};
+    trim(result);
+    return result;
+}
+
+/// Get double digit of (x >> shift) truncated to double digit width.
+double_digit_t extract_double_digit(const digits_t &x, std::size_t shift)
+{
+    const std::size_t index = shift / digit_bits;
+    const std::size_t offset = shift % digit_bits;
+
+    double_digit_t result = 0;
+    for (std::size_t j = 0; j < 3 && index + j < x.size(); ++j)
+    {
+        const std::size_t position = j * digit_bits;
+        if (position < offset)
+        {
+            result |= static_cast<double_digit_t>(x[index + j] >> offset);
+        }
+        else if (position - offset < 2 * digit_bits)
+        {
+            result |= static_cast<double_digit_t>(static_cast<double_digit_t>(x[index + j]) << (position - offset));
+        }
+    }
+    return result;
+}
+
+std::size_t count_trailing_zeros(double_digit_t x)
+{
+    const auto low = static_cast<digit_t>(x);
+    return low != 0 ? static_cast<std::size_t>(std::countr_zero(low))
+                    : digit_bits + static_cast<std::size_t>(std::countr_zero(static_cast<digit_t>(x >> digit_bits)));
+}
+
+double_digit_t double_digit_gcd(double_digit_t a, double_digit_t b)
+{
+    if (a == 0) return b;
+    if (b == 0) return a;
+
+    const std::size_t common_power_of_2 = count_trailing_zeros(static_cast<double_digit_t>(a | b));
+    a >>= count_trailing_zeros(a);
+    do
+    {
+        b >>= count_trailing_zeros(b);
+        if (a > b)
+        {
+            std::swap(a, b);
+        }
+        b -= a;
+    } while (b != 0);
+
+    return static_cast<double_digit_t>(a << common_power_of_2);
+}
+
+/// Compute Lehmer cofactor matrix for leading parts of two numbers (u >= v).
+/// Steps are accepted only if quotient is the same for both ends of the possible range of
+/// the full numbers (Knuth, TAOCP vol. 2, 4.5.2, Algorithm L) and as long as cofactors fit single digit.
+LehmerMatrix lehmer_matrix(double_digit_t u, double_digit_t v)
+{
+    LehmerMatrix m;
+    while (true)
+    {
+        double_digit_t num_1, den_1, num_2, den_2;
+        if (!m.odd)
+        {
+            if (v <= m.c || u < m.b) break;
+            num_1 = u + m.a;
+            den_1 = v - m.c;
+            num_2 = u - m.b;
+            den_2 = v + m.d;
+        }
+        else
+        {
+            if (v <= m.d || u < m.a) break;
+            num_1 = u - m.a;
+            den_1 = v + m.c;
+            num_2 = u + m.b;
+            den_2 = v - m.d;
+        }
+
+        const double_digit_t q = num_1 / den_1;
+        if (q != num_2 / den_2 || q > max_digit) break;
+
+        const double_digit_t new_c = utils::safe_mul(static_cast<digit_t>(q), m.c) + m.a;
+        const double_digit_t new_d = utils::safe_mul(static_cast<digit_t>(q), m.d) + m.b;
+        if (new_c > max_digit || new_d > max_digit) break;
+
+        const double_digit_t new_v = u - q * v;
+        u = v;
+        v = new_v;
+
+        m.a = m.c;
+        m.b = m.d;
+        m.c = static_cast<digit_t>(new_c);
+        m.d = static_cast<digit_t>(new_d);
+        m.odd = !m.odd;
+    }
+    return m;
+}
+
+/// Computes x_factor * x + y_factor * y (or x_factor * x - y_factor * y) digit by digit.
+class MulAccumulator
+{
+private:
+    digit_t x_factor, y_factor;
+    digit_t x_carry = 0, y_carry = 0;
+    bool subtract;
+    bool carry = false;
+
+public:
+    MulAccumulator(digit_t x_factor, digit_t y_factor, bool subtract)
+        : x_factor(x_factor),
+          y_factor(y_factor),
+          subtract(subtract)
+    {
+    }
+
+    digit_t step(digit_t x, digit_t y)
+    {
+        const double_digit_t px = utils::safe_mul(x_factor, x) + x_carry;
+        const double_digit_t py = utils::safe_mul(y_factor, y) + y_carry;
+        x_carry = static_cast<digit_t>(px >> digit_bits);
+        y_carry = static_cast<digit_t>(py >> digit_bits);
+
+        const auto low_x = static_cast<digit_t>(px);
+        const auto low_y = static_cast<digit_t>(py);
+
+        if (subtract)
+        {
+            const auto result = static_cast<digit_t>(low_x - low_y - static_cast<digit_t>(carry));
+            carry = (low_x < low_y) || (low_x == low_y && carry);
+            return result;
+        }
+
+        const double_digit_t sum = utils::safe_add(low_x, low_y) + carry;
+        carry = (sum >> digit_bits) != 0;
+        return static_cast<digit_t>(sum);
+    }
+
+    /// Get most significant digit of the result, in subtraction mode it is two's complement digit.
+    digit_t finish() const
+    {
+        const auto carry_digit = static_cast<digit_t>(carry);
+        return subtract ? static_cast<digit_t>(x_carry - y_carry - carry_digit)
+                        : static_cast<digit_t>(x_carry + y_carry + carry_digit);
+    }
+};
+
+/// Apply Lehmer matrix to the numbers in place: (u; v) <- M * (u; v).
+/// Both results are known to be non-negative and not greater than u.
+void apply_lehmer_matrix(digits_t &u, digits_t &v, const LehmerMatrix &m)
+{
+    v.resize(u.size(), 0);
+
+    MulAccumulator first = m.odd ? MulAccumulator(m.b, m.a, true) : MulAccumulator(m.a, m.b, true);
+    MulAccumulator second = m.odd ? MulAccumulator(m.c, m.d, true) : MulAccumulator(m.d, m.c, true);
+
+    for (std::size_t i = 0; i < u.size(); ++i)
+    {
+        const digit_t new_u = m.odd ? first.step(v[i], u[i]) : first.step(u[i], v[i]);
+        const digit_t new_v = m.odd ? second.step(u[i], v[i]) : second.step(v[i], u[i]);
+        u[i] = new_u;
+        v[i] = new_v;
+    }
+
+    trim(u);
+    trim(v);
+}
+
+/// Update cofactor magnitudes of the single matrix column: (x; y) <- |M| * (x; y).
+void apply_lehmer_matrix_to_cofactors(digits_t &x, digits_t &y, const LehmerMatrix &m)
+{
+    const std::size_t size = std::max(x.size(), y.size()) + 1;
+    x.resize(size, 0);
+    y.resize(size, 0);
+
+    MulAccumulator first(m.a, m.b, false);
+    MulAccumulator second(m.c, m.d, false);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const digit_t new_x = first.step(x[i], y[i]);
+        const digit_t new_y = second.step(x[i], y[i]);
+        x[i] = new_x;
+        y[i] = new_y;
+    }
+
+    trim(x);
+    trim(y);
+}
+
+digit_t magnitude(signed_digit_t x)
+{
+    return x < 0 ? static_cast<digit_t>(digit_t{0} - static_cast<digit_t>(x)) : static_cast<digit_t>(x);
+}
+
+void negate(digits_t &x)
+{
+    bool carry = true;
+    for (auto &digit : x)
+    {
+        digit = static_cast<digit_t>(static_cast<digit_t>(~digit) + static_cast<digit_t>(carry));
+        carry = carry && digit == 0;
+    }
+}
+
+void shift_right(digits_t &x, std::size_t shift)
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        const digit_t next = i + 1 < x.size() ? static_cast<digit_t>(x[i + 1] << (digit_bits - shift)) : 0;
+        x[i] = static_cast<digit_t>((x[i] >> shift) | next);
+    }
+    trim(x);
+}
+
+/// Approximation of x used by batched binary gcd. It consists of top digit_bits bits of n-bit number
+/// and exact low binary_batch_steps bits, so all the steps are exact for low part of the number.
+double_digit_t binary_approximation(const digits_t &x, std::size_t n)
+{
+    constexpr auto low_mask = static_cast<digit_t>((digit_t{1} << binary_batch_steps) - 1);
+    const double_digit_t low = x.empty() ? 0 : (x.front() & low_mask);
+    const double_digit_t high = extract_double_digit(x, n - digit_bits);
+    return static_cast<double_digit_t>((high << binary_batch_steps) | low);
+}
+
+/// Run binary_batch_steps steps of binary gcd on approximations (b must be odd).
+BinaryMatrix binary_gcd_matrix(double_digit_t a, double_digit_t b)
+{
+    BinaryMatrix m;
+    std::size_t i = 0;
+
+    while (i < binary_batch_steps)
+    {
+        if ((a & 1) == 0)
+        {
+            const std::size_t remaining = binary_batch_steps - i;
+            const std::size_t zeros = a == 0 ? remaining : std::min(count_trailing_zeros(a), remaining);
+            a >>= zeros;
+            m.f1 = static_cast<signed_digit_t>(m.f1 * (signed_digit_t{1} << zeros));
+            m.g1 = static_cast<signed_digit_t>(m.g1 * (signed_digit_t{1} << zeros));
+            i += zeros;
+            continue;
+        }
+
+        if (a < b)
+        {
+            std::swap(a, b);
+            std::swap(m.f0, m.f1);
+            std::swap(m.g0, m.g1);
+        }
+
+        a = static_cast<double_digit_t>((a - b) >> 1);
+        m.f0 = static_cast<signed_digit_t>(m.f0 - m.f1);
+        m.g0 = static_cast<signed_digit_t>(m.g0 - m.g1);
+        m.f1 = static_cast<signed_digit_t>(m.f1 * 2);
+        m.g1 = static_cast<signed_digit_t>(m.g1 * 2);
+        ++i;
+    }
+    return m;
+}
+
+/// Linear combination with signed factors computed as a difference of positive terms.
+struct BinaryMatrixRow
+{
+    MulAccumulator accumulator;
+    bool swapped;
+
+    BinaryMatrixRow(signed_digit_t f, signed_digit_t g)
+        : accumulator(f < 0 && g >= 0 ? MulAccumulator(magnitude(g), magnitude(f), true)
+                                      : MulAccumulator(magnitude(f), magnitude(g), (f < 0) != (g < 0))),
+          swapped(f < 0 && g >= 0)
+    {
+    }
+
+    digit_t step(digit_t a, digit_t b)
+    {
+        return swapped ? accumulator.step(b, a) : accumulator.step(a, b);
+    }
+};
+
+/// Apply binary gcd factors to the numbers in place, results are replaced with absolute values.
+void apply_binary_matrix(digits_t &a, digits_t &b, const BinaryMatrix &m)
+{
+    const std::size_t size = std::max(a.size(), b.size());
+    a.resize(size, 0);
+    b.resize(size, 0);
+
+    BinaryMatrixRow first(m.f0, m.g0);
+    BinaryMatrixRow second(m.f1, m.g1);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const digit_t new_a = first.step(a[i], b[i]);
+        const digit_t new_b = second.step(a[i], b[i]);
+        a[i] = new_a;
+        b[i] = new_b;
+    }
+
+    constexpr auto sign_bit = static_cast<digit_t>(digit_t{1} << (digit_bits - 1));
+    for (auto [x, row] : {std::make_pair(&a, &first), std::make_pair(&b, &second)})
+    {
+        x->push_back(row->accumulator.finish());
+        if (x->back() & sign_bit)
+        {
+            negate(*x);
+        }
+        shift_right(*x, binary_batch_steps);
+    }
+}
+
+/// Batched binary gcd (T. Pornin, "Optimized Binary GCD for Modular Inversion").
+/// Every pass over the full numbers performs binary_batch_steps steps, b must be odd.
+digits_t binary_gcd(digits_t a, digits_t b)
+{
+    while (!a.empty())
+    {
+        if (a.size() <= 2 && b.size() <= 2)
+        {
+            return from_double_digit(double_digit_gcd(to_double_digit(a), to_double_digit(b)));
+        }
+
+        const std::size_t n = std::max({bit_length(a), bit_length(b), 2 * digit_bits - 2});
+        apply_binary_matrix(a, b, binary_gcd_matrix(binary_approximation(a, n), binary_approximation(b, n)));
+    }
+    return b;
+}
+
+/// Perform single Euclid division step: (u, v) <- (v, u mod v).
+bigint::BigInt euclid_step(digits_t &u, digits_t &v)
+{
+    auto [quotient, remainder] = bigint::BigInt(u).divide(bigint::BigInt(v));
+    u = std::move(v);
+    v = remainder.raw_data();
+    return quotient;
+}
+
+/// Compute gcd of two numbers, at least one of them must be odd.
+digits_t lehmer_gcd(digits_t u, digits_t v)
+{
+    while (true)
+    {
+        if (abs_lower(u, v))
+        {
+            std::swap(u, v);
+        }
+
+        if (v.empty())
+        {
+            return u;
+        }
+
+        if (u.size() <= binary_gcd_threshold_digits)
+        {
+            return (v.front() & 1) ? binary_gcd(std::move(u), std::move(v)) : binary_gcd(std::move(v), std::move(u));
+        }
+
+        const std::size_t shift = bit_length(u) - std::min(bit_length(u), lehmer_bits);
+        const LehmerMatrix m = lehmer_matrix(extract_double_digit(u, shift), extract_double_digit(v, shift));
+
+        if (m.b == 0)
+        {
+            euclid_step(u, v);
+        }
+        else
+        {
+            apply_lehmer_matrix(u, v, m);
+        }
+    }
+}
+
+/// Finish Euclid algorithm on numbers fitting in double digit. Cofactor magnitudes of the steps
+/// are accumulated in double digits and applied to the tracked cofactor at the end.
+double_digit_t double_digit_gcd(double_digit_t u, double_digit_t v, SingleCofactor &cofactor)
+{
+    double_digit_t p00 = 1, p01 = 0, p10 = 0, p11 = 1;
+    bool odd = false;
+
+    while (v != 0)
+    {
+        const double_digit_t quotient = u / v;
+        u = std::exchange(v, static_cast<double_digit_t>(u - quotient * v));
+        p00 = std::exchange(p10, static_cast<double_digit_t>(p00 + quotient * p10));
+        p01 = std::exchange(p11, static_cast<double_digit_t>(p01 + quotient * p11));
+        odd = !odd;
+    }
+
+    cofactor.x0 = (bigint::BigInt(from_double_digit(p00)) * bigint::BigInt(cofactor.x0) +
+                   bigint::BigInt(from_double_digit(p01)) * bigint::BigInt(cofactor.x1))
+                      .raw_data();
+    cofactor.odd = cofactor.odd != odd;
+    return u;
+}
+
+/// Compute gcd of two numbers together with cofactor x of the second one: gcd = x * v (mod u).
+/// Follows exactly the Euclid remainder sequence, so the cofactor is the minimal one.
+std::pair<digits_t, bigint::BigInt> lehmer_gcd_with_cofactor(digits_t u, digits_t v)
+{
+    SingleCofactor cofactor;
+
+    while (true)
+    {
+        if (abs_lower(u, v))
+        {
+            std::swap(u, v);
+            std::swap(cofactor.x0, cofactor.x1);
+            cofactor.odd = !cofactor.odd;
+        }
+
+        if (v.empty())
+        {
+            break;
+        }
+
+        if (u.size() <= 2)
+        {
+            u = from_double_digit(double_digit_gcd(to_double_digit(u), to_double_digit(v), cofactor));
+            break;
+        }
+
+        const std::size_t shift = bit_length(u) - std::min(bit_length(u), lehmer_bits);
+        const LehmerMatrix m = lehmer_matrix(extract_double_digit(u, shift), extract_double_digit(v, shift));
+
+        if (m.b == 0)
+        {
+            const auto quotient = euclid_step(u, v);
+            const auto next = bigint::BigInt(cofactor.x0) + quotient * bigint::BigInt(cofactor.x1);
+            cofactor.x0 = std::exchange(cofactor.x1, next.raw_data());
+            cofactor.odd = !cofactor.odd;
+        }
+        else
+        {
+            apply_lehmer_matrix(u, v, m);
+            apply_lehmer_matrix_to_cofactors(cofactor.x0, cofactor.x1, m);
+            cofactor.odd = cofactor.odd != m.odd;
+        }
+    }
+
+    return {std::move(u),
+            bigint::BigInt(std::move(cofactor.x0), cofactor.odd ? bigint::Sign::Minus : bigint::Sign::Plus)};
+}
+
+void normalize(HalfGcdResult &result)
+{
+    auto &[m, alpha, beta] = result;
+
+    if (alpha.is_negative())
+    {
+        alpha = -alpha;
+        m.m00 = -m.m00;
+        m.m01 = -m.m01;
+    }
+
+    if (beta.is_negative())
+    {
+        beta = -beta;
+        m.m10 = -m.m10;
+        m.m11 = -m.m11;
+    }
+
+    if (alpha < beta)
+    {
+        std::swap(alpha, beta);
+        std::swap(m.m00, m.m10);
+        std::swap(m.m01, m.m11);
+    }
+}
+
+void euclid_step(HalfGcdResult &result)
+{
+    auto &[m, alpha, beta] = result;
+    auto [quotient, remainder] = alpha.divide(beta);
+
+    alpha = std::move(beta);
+    beta = std::move(remainder);
+
+    m.m00 = std::exchange(m.m10, m.m00 - quotient * m.m10);
+    m.m01 = std::exchange(m.m11, m.m01 - quotient * m.m11);
+}
+
+/// Reduce numbers with Lehmer steps until beta has at most target_bits bits.
+HalfGcdResult lehmer_half_gcd(const bigint::BigInt &a, const bigint::BigInt &b, std::size_t target_bits)
+{
+    digits_t u = a.raw_data();
+    digits_t v = b.raw_data();
+    digits_t m00{1}, m01, m10, m11{1};
+    bool odd = false;
+
+    while (bit_length(v) > target_bits)
+    {
+        const std::size_t shift = std::max(bit_length(u) - std::min(bit_length(u), lehmer_bits), target_bits);
+        const LehmerMatrix m = lehmer_matrix(extract_double_digit(u, shift), extract_double_digit(v, shift));
+
+        if (m.b == 0)
+        {
+            const auto quotient = euclid_step(u, v);
+            m00 = (bigint::BigInt(m00) + quotient * bigint::BigInt(m10)).raw_data();
+            m01 = (bigint::BigInt(m01) + quotient * bigint::BigInt(m11)).raw_data();
+            std::swap(m00, m10);
+            std::swap(m01, m11);
+            odd = !odd;
+        }
+        else
+        {
+            apply_lehmer_matrix(u, v, m);
+            apply_lehmer_matrix_to_cofactors(m00, m10, m);
+            apply_lehmer_matrix_to_cofactors(m01, m11, m);
+            odd = odd != m.odd;
+        }
+    }
+
+    const auto plus_if = [](bool positive) { return positive ? bigint::Sign::Plus : bigint::Sign::Minus; };
+
+    HalfGcdResult result;
+    result.matrix.m00 = bigint::BigInt(std::move(m00), plus_if(!odd));
+    result.matrix.m01 = bigint::BigInt(std::move(m01), plus_if(odd));
+    result.matrix.m10 = bigint::BigInt(std::move(m10), plus_if(odd));
+    result.matrix.m11 = bigint::BigInt(std::move(m11), plus_if(!odd));
+    result.alpha = bigint::BigInt(std::move(u));
+    result.beta = bigint::BigInt(std::move(v));
+    return result;
+}
+
+std::pair<bigint::BigInt, bigint::BigInt> split(const bigint::BigInt &x, std::size_t low_digits)
+{
+    const auto &data = x.raw_data();
+    const auto middle = data.begin() + static_cast<std::ptrdiff_t>(std::min(low_digits, data.size()));
+    return {bigint::BigInt(std::span<digit_t const>(middle, data.end())),
+            bigint::BigInt(std::span<digit_t const>(data.begin(), middle))};
+}
+
+CofactorMatrix operator*(const CofactorMatrix &x, const CofactorMatrix &y)
+{
+    return {x.m00 * y.m00 + x.m01 * y.m10, x.m00 * y.m01 + x.m01 * y.m11, x.m10 * y.m00 + x.m11 * y.m10,
+            x.m10 * y.m01 + x.m11 * y.m11};
+}
+
+/// Half-gcd reduction step for the numbers split at low_digits position. Matrix computed recursively
+/// for the high parts is extended to the full numbers.
+HalfGcdResult half_gcd(const bigint::BigInt &a, const bigint::BigInt &b);
+
+HalfGcdResult half_gcd_of_high_parts(const bigint::BigInt &a, const bigint::BigInt &b, std::size_t low_digits)
+{
+    constexpr auto digit_bits_shift = static_cast<uint64_t>(digit_bits);
+    const auto [a_high, a_low] = split(a, low_digits);
+    const auto [b_high, b_low] = split(b, low_digits);
+
+    HalfGcdResult result = half_gcd(a_high, b_high);
+    auto &[m, alpha, beta] = result;
+
+    alpha = (alpha << (low_digits * digit_bits_shift)) + m.m00 * a_low + m.m01 * b_low;
+    beta = (beta << (low_digits * digit_bits_shift)) + m.m10 * a_low + m.m11 * b_low;
+    normalize(result);
+    return result;
+}
+
+/// Compute matrix reducing numbers (a >= b) to about half of the size of a (Moller's subquadratic HGCD).
+/// Matrix is always unimodular, so gcd of the results is the same as gcd of the inputs.
+HalfGcdResult half_gcd(const bigint::BigInt &a, const bigint::BigInt &b)
+{
+    const std::size_t n = a.raw_data().size();
+    const std::size_t s = n / 2 + 1;
+
+    if (n <= hgcd_threshold_digits)
+    {
+        return lehmer_half_gcd(a, b, s * digit_bits);
+    }
+
+    if (b.raw_data().size() <= s)
+    {
+        return {CofactorMatrix{}, a, b};
+    }
+
+    HalfGcdResult result = half_gcd_of_high_parts(a, b, s);
+    if (result.beta.raw_data().size() <= s)
+    {
+        return result;
+    }
+
+    euclid_step(result);
+    if (result.beta.raw_data().size() <= s)
+    {
+        return result;
+    }
+
+    const std::size_t l = result.alpha.raw_data().size();
+    const std::size_t p = 2 * s > l ? 2 * s - l : 0;
+    HalfGcdResult second = half_gcd_of_high_parts(result.alpha, result.beta, p);
+    second.matrix = second.matrix * result.matrix;
+
+    while (second.beta.raw_data().size() > s)
+    {
+        euclid_step(second);
+    }
+    return second;
+}
+
+/// Compute gcd of a >= b > 0 together with cofactor x of b: gcd = x * b (mod a).
+/// Large numbers are reduced with half-gcd first, only the cofactors of b are carried through the reduction.
+std::pair<bigint::BigInt, bigint::BigInt> gcd_with_cofactor(const bigint::BigInt &a, const bigint::BigInt &b)
+{
+    if (b.raw_data().size() <= hgcd_threshold_digits)
+    {
+        auto [result, cofactor] = lehmer_gcd_with_cofactor(a.raw_data(), b.raw_data());
+        return {bigint::BigInt(std::move(result)), std::move(cofactor)};
+    }
+
+    // Invariant: number = s0 * b (mod a), other = s1 * b (mod a)
+    bigint::BigInt number = a, other = b;
+    bigint::BigInt s0(0), s1(1);
+
+    while (other.raw_data().size() > hgcd_threshold_digits)
+    {
+        HalfGcdResult reduced = half_gcd(number, other);
+        if (!reduced.beta.is_zero())
+        {
+            euclid_step(reduced);
+        }
+
+        const auto &m = reduced.matrix;
+        std::tie(s0, s1) = std::pair{m.m00 * s0 + m.m01 * s1, m.m10 * s0 + m.m11 * s1};
+        number = std::move(reduced.alpha);
+        other = std::move(reduced.beta);
+    }
+
+    bigint::BigInt result = number;
+    bigint::BigInt cofactor = s0;
+    if (!other.is_zero())
+    {
+        auto [small_result, y] = lehmer_gcd_with_cofactor(number.raw_data(), other.raw_data());
+        result = bigint::BigInt(std::move(small_result));
+        const auto x = (result - y * other).divexact(number);
+        cofactor = x * s0 + y * s1;
+    }
+
+    // Bring the cofactor to the same range as produced by Euclid algorithm
+    const auto period = a.divexact(result);
+    cofactor = cofactor % period;
+    if (cofactor.is_negative())
+    {
+        cofactor += period;
+    }
+    if (cofactor > (period >> 1))
+    {
+        cofactor -= period;
+    }
+
+    return {std::move(result), std::move(cofactor)};
+}
+
+}  // namespace
+
+yabil::bigint::BigInt gcd(yabil::bigint::BigInt number, yabil::bigint::BigInt other)
+{
+    number.set_sign(bigint::Sign::Plus);
+    other.set_sign(bigint::Sign::Plus);
+
+    if (number.is_zero()) return other;
+    if (other.is_zero()) return number;
+
+    uint64_t power_of_two_divisor_number = 0;
+    uint64_t power_of_two_divisor_other = 0;
+
+    for (const auto &digit : number.raw_data())
+    {
+        const uint64_t counted_zeroes = std::countr_zero(digit);
+        power_of_two_divisor_number += counted_zeroes;
+        if (counted_zeroes != sizeof(bigint::bigint_base_t) * 8) break;
+    }
+
+    for (const auto &digit : other.raw_data())
+    {
+        const uint64_t counted_zeroes = std::countr_zero(digit);
+        power_of_two_divisor_other += counted_zeroes;
+        if (counted_zeroes != sizeof(bigint::bigint_base_t) * 8) break;
+    }
+
+    uint64_t common_power_of_2 = std::min(power_of_two_divisor_number, power_of_two_divisor_other);
+    number >>= common_power_of_2;
+    other >>= common_power_of_2;
+
+    if (number.is_int64() && other.is_int64())
+    {
+        return yabil::bigint::BigInt(std::gcd(number.to_int(), other.to_int())) << common_power_of_2;
+    }
+
+    if (number < other)
+    {
+        std::swap(number, other);
+    }
+
+    while (other.raw_data().size() > hgcd_threshold_digits)
+    {
+        HalfGcdResult reduced = half_gcd(number, other);
+        if (!reduced.beta.is_zero())
+        {
+            euclid_step(reduced);
+        }
+        number = std::move(reduced.alpha);
+        other = std::move(reduced.beta);
+    }
+
+    return yabil::bigint::BigInt(lehmer_gcd(number.raw_data(), other.raw_data())) << common_power_of_2;
+}
+
+std::pair<yabil::bigint::BigInt, std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt>> extended_gcd(
+    const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &b)
+{
+    using BezoutCoefficients = std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt>;
+
+    yabil::bigint::BigInt abs_a = a, abs_b = b;
+    abs_a.set_sign(bigint::Sign::Plus);
+    abs_b.set_sign(bigint::Sign::Plus);
+
+    yabil::bigint::BigInt result, x, y;
+
+    if (abs_b.is_zero())
+    {
+        std::tie(result, x, y) = std::tuple{abs_a, yabil::bigint::BigInt(1), yabil::bigint::BigInt(0)};
+    }
+    else if (abs_a.is_zero())
+    {
+        std::tie(result, x, y) = std::tuple{abs_b, yabil::bigint::BigInt(0), yabil::bigint::BigInt(1)};
+    }
+    else if (abs_a < abs_b)
+    {
+        std::tie(result, x) = gcd_with_cofactor(abs_b, abs_a);
+        y = (result - x * abs_a).divexact(abs_b);
+    }
+    else
+    {
+        std::tie(result, y) = gcd_with_cofactor(abs_a, abs_b);
+        x = (result - y * abs_b).divexact(abs_a);
+    }
+
+    if (a.is_negative()) x = -x;
+    if (b.is_negative()) y = -y;
+
+    return {result, BezoutCoefficients{x, y}};
+}
+
+yabil::bigint::BigInt mod_inverse(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &n)
+{
+    if (n == yabil::bigint::BigInt(1))
+    {
+        return yabil::bigint::BigInt(0);
+    }
+
+    auto reduced = a % n;
+    if (reduced.is_negative())
+    {
+        reduced += n;
+    }
+
+    if (reduced.is_zero())
+    {
+        throw std::runtime_error("number: " + a.to_str() + " is not invertible");
+    }
+
+    auto [result, inverse] = gcd_with_cofactor(n, reduced);
+    if (result != yabil::bigint::BigInt(1))
+    {
+        throw std::runtime_error("number: " + a.to_str() + " is not invertible");
+    }
+
+    return inverse.is_negative() ? inverse + n : inverse;
+}
+
+}  // namespace yabil::math
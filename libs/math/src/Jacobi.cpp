@@ -0,0 +1,270 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "Bits.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+constexpr std::size_t digit_bits = bigint::bigint_base_t_size_bits;
+
+// Number of leading bits of the longer operand kept in approximations of batched binary steps
+constexpr uint64_t approximation_high_bits = 32;
+
+// Number of exact low bits kept in approximations of batched binary steps
+constexpr uint64_t approximation_low_bits = 32;
+
+// Steps of single batch, limited so that the lowest 3 bits of both numbers stay exact in the last step
+constexpr uint64_t jacobi_batch_steps = approximation_low_bits - 2;
+
+// Numbers differing in length by more than this number of bits are reduced by division instead of binary steps
+constexpr uint64_t jacobi_unbalanced_bits = 32;
+
+/// Get 64 bits of x >> shift.
+uint64_t extract_bits(const bigint::BigInt &x, uint64_t shift)
+{
+    const auto &data = x.raw_data();
+    uint64_t result = 0;
+    for (uint64_t position = 0; position < 64;)
+    {
+        const uint64_t bit = shift + position;
+        const std::size_t index = bit / digit_bits;
+        if (index >= data.size())
+        {
+            break;
+        }
+
+        const uint64_t offset = bit % digit_bits;
+        result |= (static_cast<uint64_t>(data[index]) >> offset) << position;
+        position += digit_bits - offset;
+    }
+    return result;
+}
+
+uint64_t low_digit(const bigint::BigInt &x)
+{
+    return x.raw_data().empty() ? 0 : static_cast<uint64_t>(x.raw_data().front());
+}
+
+/// (2 | b) = -1 for b = 3, 5 (mod 8).
+bool two_flips_sign(uint64_t b)
+{
+    return ((b >> 1) ^ (b >> 2)) & 1;
+}
+
+/// Quadratic reciprocity: (a | b) = -(b | a) for odd positive a = b = 3 (mod 4).
+bool reciprocity_flips_sign(uint64_t a, uint64_t b)
+{
+    return (a & b & 2) != 0;
+}
+
+/// Binary algorithm for numbers fitting into 64 bits, b must be odd.
+int jacobi_uint64(uint64_t a, uint64_t b, bool negated)
+{
+    while (a != 0)
+    {
+        const int twos = std::countr_zero(a);
+        a >>= twos;
+        negated ^= (twos & 1) && two_flips_sign(b);
+
+        if (a < b)
+        {
+            negated ^= reciprocity_flips_sign(a, b);
+            std::swap(a, b);
+        }
+        a -= b;
+    }
+
+    if (b != 1)
+    {
+        return 0;
+    }
+    return negated ? -1 : 1;
+}
+
+/// Factors of batched binary steps: a' = (f0 * a + g0 * b) / 2^steps, b' = (f1 * a + g1 * b) / 2^steps.
+struct JacobiMatrix
+{
+    int64_t f0 = 1;
+    int64_t g0 = 0;
+    int64_t f1 = 0;
+    int64_t g1 = 1;
+    uint64_t steps = 0;
+    bool negated = false;
+};
+
+/// Run binary steps on approximations of a and b (b odd) consisting of top bits at position length and exact low bits.
+/// High part of a number after j steps is known with error lower than 2^j (scaled by 2^j), so the step is taken only
+/// when comparison of the numbers is certain. This keeps every step exact, so both numbers stay positive and
+/// reciprocity can be applied.
+JacobiMatrix jacobi_matrix(const bigint::BigInt &a, const bigint::BigInt &b, uint64_t length)
+{
+    constexpr uint64_t low_mask = (uint64_t{1} << approximation_low_bits) - 1;
+    constexpr uint64_t high_mask = (uint64_t{1} << approximation_high_bits) - 1;
+    const uint64_t shift = length - approximation_high_bits;
+
+    auto high_a = static_cast<int64_t>(extract_bits(a, shift) & high_mask);
+    auto high_b = static_cast<int64_t>(extract_bits(b, shift) & high_mask);
+    uint64_t low_a = extract_bits(a, 0) & low_mask;
+    uint64_t low_b = extract_bits(b, 0) & low_mask;
+
+    JacobiMatrix m;
+    for (; m.steps < jacobi_batch_steps; ++m.steps)
+    {
+        if (low_a & 1)
+        {
+            const int64_t difference = high_a - high_b;
+            const int64_t error = int64_t{2} << m.steps;
+            if (difference < error && difference > -error)
+            {
+                break;
+            }
+
+            if (difference < 0)
+            {
+                m.negated ^= reciprocity_flips_sign(low_a, low_b);
+                std::swap(high_a, high_b);
+                std::swap(low_a, low_b);
+                std::swap(m.f0, m.f1);
+                std::swap(m.g0, m.g1);
+            }
+
+            high_a -= high_b;
+            low_a -= low_b;
+            m.f0 -= m.f1;
+            m.g0 -= m.g1;
+        }
+
+        // a' = a / 2, so b is doubled to keep common denominator
+        low_a >>= 1;
+        high_b <<= 1;
+        m.f1 <<= 1;
+        m.g1 <<= 1;
+        m.negated ^= two_flips_sign(low_b);
+    }
+    return m;
+}
+
+/// Single exact step of binary algorithm on full numbers.
+void jacobi_step(bigint::BigInt &a, bigint::BigInt &b, bool &negated)
+{
+    const uint64_t twos = trailing_zeros(a);
+    a >>= twos;
+    negated ^= (twos & 1) && two_flips_sign(low_digit(b));
+
+    if (a < b)
+    {
+        negated ^= reciprocity_flips_sign(low_digit(a), low_digit(b));
+        std::swap(a, b);
+    }
+    a -= b;
+}
+
+/// Jacobi symbol for 0 <= a and odd positive b.
+int jacobi_positive(bigint::BigInt a, bigint::BigInt b)
+{
+    bool negated = false;
+    while (!a.is_zero())
+    {
+        const uint64_t a_length = bit_length(a);
+        const uint64_t b_length = bit_length(b);
+
+        if (a_length <= 64 && b_length <= 64)
+        {
+            return jacobi_uint64(a.to_uint(), b.to_uint(), negated);
+        }
+
+        if (a_length > b_length + jacobi_unbalanced_bits)
+        {
+            a = a % b;
+        }
+        else if (b_length > a_length + jacobi_unbalanced_bits)
+        {
+            const uint64_t twos = trailing_zeros(a);
+            a >>= twos;
+            negated ^= (twos & 1) && two_flips_sign(low_digit(b));
+            negated ^= reciprocity_flips_sign(low_digit(a), low_digit(b));
+            b = b % a;
+            std::swap(a, b);
+        }
+        else
+        {
+            const auto m = jacobi_matrix(a, b, std::max(a_length, b_length));
+            if (m.steps == 0)
+            {
+                jacobi_step(a, b, negated);
+                continue;
+            }
+
+            auto next_a = (a * bigint::BigInt(m.f0) + b * bigint::BigInt(m.g0)) >> m.steps;
+            b = (a * bigint::BigInt(m.f1) + b * bigint::BigInt(m.g1)) >> m.steps;
+            a = std::move(next_a);
+            negated ^= m.negated;
+        }
+    }
+
+    if (b != bigint::BigInt(1))
+    {
+        return 0;
+    }
+    return negated ? -1 : 1;
+}
+
+}  // namespace
+
+int jacobi(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &n)
+{
+    if (n.is_negative() || n.is_even())
+    {
+        throw std::invalid_argument("Jacobi symbol is defined only for odd positive n");
+    }
+
+    if (a.is_negative() || a >= n)
+    {
+        auto reduced = a % n;
+        return jacobi_positive(reduced.is_negative() ? reduced + n : std::move(reduced), n);
+    }
+    return jacobi_positive(a, n);
+}
+
+int kronecker(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &n)
+{
+    if (n.is_zero())
+    {
+        return a.abs() == yabil::bigint::BigInt(1) ? 1 : 0;
+    }
+
+    // (a | -1) = -1 for negative a
+    int result = (n.is_negative() && a.is_negative()) ? -1 : 1;
+    auto odd_n = n.abs();
+
+    const uint64_t twos = trailing_zeros(odd_n);
+    if (twos != 0)
+    {
+        if (a.is_even())
+        {
+            return 0;
+        }
+
+        // (a | 2) = -1 for a = 3, 5 (mod 8), low digit of negative a is negated
+        const uint64_t a_mod_8 = a.is_negative() ? (0 - low_digit(a)) & 7 : low_digit(a) & 7;
+        if ((twos & 1) && two_flips_sign(a_mod_8))
+        {
+            result = -result;
+        }
+        odd_n >>= twos;
+    }
+
+    return result * jacobi(a, odd_n);
+}
+
+}  // namespace yabil::math
@@ -1,11 +1,10 @@
 #include <yabil/bigint/Parallel.h>
 #include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
 
 #include <bit>
 #include <cmath>
-#include <numeric>
 #include <stdexcept>
-#include <tuple>
 
 namespace yabil::math
 {
@@ -55,6 +54,13 @@ yabil::bigint::BigInt pow(const yabil::bigint::BigInt &number, const yabil::bigi
         return yabil::bigint::BigInt();
     }
 
+    // Modulus 1 gives zero base, so any odd modulus here is valid for Montgomery form
+    if (!mod.is_even())
+    {
+        const MontgomeryContext context(mod);
+        return context.from_montgomery(context.pow(context.to_montgomery(base), exponent));
+    }
+
     while (!exponent.is_zero())
     {
         if (!exponent.is_even())
@@ -67,14 +73,16 @@ yabil::bigint::BigInt pow(const yabil::bigint::BigInt &number, const yabil::bigi
     return result;
 }
 
-yabil::bigint::BigInt factorial(uint64_t n)
+yabil::bigint::BigInt pow_consttime(const yabil::bigint::BigInt &number, const yabil::bigint::BigInt &n,
+                                    const yabil::bigint::BigInt &mod)
 {
-    yabil::bigint::BigInt result(1U);
-    for (uint64_t i = 1; i <= n; ++i)
+    if (number.is_negative() || n.is_negative() || mod.is_negative())
     {
-        result *= yabil::bigint::BigInt(i);
+        throw std::invalid_argument("Cannot calculate power in modular arithmetic for negative number");
     }
-    return result;
+
+    const MontgomeryContext context(mod);
+    return context.from_montgomery(context.pow_consttime(context.to_montgomery(number), n));
 }
 
 uint64_t log2_int(const yabil::bigint::BigInt &number)
@@ -128,118 +136,4 @@ double log(const yabil::bigint::BigInt &number, double base)
     return log2(number) / std::log2(base);
 }
 
-yabil::bigint::BigInt gcd(yabil::bigint::BigInt number, yabil::bigint::BigInt other)
-{
-    if (number.is_zero()) return other;
-    if (other.is_zero()) return number;
-
-    uint64_t power_of_two_divisor_number = 0;
-    uint64_t power_of_two_divisor_other = 0;
-
-    for (const auto &digit : number.raw_data())
-    {
-        const uint64_t counted_zeroes = std::countr_zero(digit);
-        power_of_two_divisor_number += counted_zeroes;
-        if (counted_zeroes != sizeof(bigint::bigint_base_t) * 8) break;
-    }
-
-    for (const auto &digit : other.raw_data())
-    {
-        const uint64_t counted_zeroes = std::countr_zero(digit);
-        power_of_two_divisor_other += counted_zeroes;
-        if (counted_zeroes != sizeof(bigint::bigint_base_t) * 8) break;
-    }
-
-    uint64_t common_power_of_2 = std::min(power_of_two_divisor_number, power_of_two_divisor_other);
-    number >>= common_power_of_2;
-    other >>= common_power_of_2;
-
-    if (number.is_int64() && other.is_int64())
-    {
-        return yabil::bigint::BigInt(std::gcd(number.to_int(), other.to_int())) << common_power_of_2;
-    }
-
-    while (!other.is_zero())
-    {
-        std::tie(number, other) = std::make_pair(other, number % other);
-    }
-
-    return number << common_power_of_2;
-}
-
-std::pair<yabil::bigint::BigInt, std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt>> extended_gcd(
-    const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &b)
-{
-    using BezoutCoefficients = std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt>;
-    yabil::bigint::BigInt old_r{a}, r{b}, old_s{1}, s{0}, old_t{0}, t{1};
-
-    while (!r.is_zero())
-    {
-        const auto quotient = old_r / r;
-        std::tie(old_r, r) = BezoutCoefficients{r, old_r - (quotient * r)};
-        std::tie(old_s, s) = BezoutCoefficients{s, old_s - (quotient * s)};
-        std::tie(old_t, t) = BezoutCoefficients{t, old_t - (quotient * t)};
-    }
-
-    return {old_r, {old_s, old_t}};
-}
-
-yabil::bigint::BigInt mod_inverse(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &n)
-{
-    const auto result = extended_gcd(a, n);
-    if (result.first > yabil::bigint::BigInt(1))
-    {
-        throw std::runtime_error("number: " + a.to_str() + " is not invertible");
-    }
-    const auto &x = result.second.first;
-    return x.is_negative() ? x + n : x;
-}
-
-yabil::bigint::BigInt sqrt(const yabil::bigint::BigInt &n)
-{
-    yabil::bigint::BigInt tmp = n;
-    yabil::bigint::BigInt result;
-
-    if (n.is_zero())
-    {
-        return bigint::BigInt();
-    }
-
-    if (n.is_negative())
-    {
-        throw std::invalid_argument("Cannot calculate square root for negative integer");
-    }
-
-    do
-    {
-        result = tmp;
-        tmp = (result + n / result) >> 1;
-    } while (tmp < result);
-    return result;
-}
-
-yabil::bigint::BigInt root(const yabil::bigint::BigInt &n, const yabil::bigint::BigInt &k)
-{
-    if (n.is_zero())
-    {
-        return bigint::BigInt();
-    }
-
-    if (n.is_negative())
-    {
-        throw std::invalid_argument("Cannot calculate square root for negative integer");
-    }
-
-    bigint::BigInt tmp = n;
-    bigint::BigInt result;
-    const bigint::BigInt one(1);
-
-    do
-    {
-        result = tmp;
-        tmp = ((k - one) * result + n / pow(result, k - one)) / k;
-    } while (tmp < result);
-    return result;
-}
-
 }  // namespace yabil::math
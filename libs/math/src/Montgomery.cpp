@@ -0,0 +1,370 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
+#include <yabil/utils/TypeUtils.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Bits.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+using digit_t = bigint::bigint_base_t;
+using double_digit_t = utils::double_width_t<digit_t>;
+using digits_t = std::vector<digit_t>;
+
+constexpr std::size_t digit_bits = bigint::bigint_base_t_size_bits;
+
+// Moduli longer than this (in digits) use reduction built on subquadratic multiplication
+constexpr std::size_t montgomery_basecase_threshold_digits = 384;
+
+/// Get number of bits of sliding window for exponent of given length.
+std::size_t window_bits(std::size_t exponent_bits)
+{
+    if (exponent_bits > 768) return 6;
+    if (exponent_bits > 240) return 5;
+    if (exponent_bits > 80) return 4;
+    if (exponent_bits > 24) return 3;
+    return 1;
+}
+
+/// Compute -n^-1 mod 2^digit_bits with Newton iteration, n must be odd.
+digit_t negated_digit_inverse(digit_t n)
+{
+    // Every odd number is its own inverse modulo 8
+    digit_t inverse = n;
+    for (std::size_t correct_bits = 3; correct_bits < digit_bits; correct_bits *= 2)
+    {
+        const auto correction = static_cast<digit_t>(2 - static_cast<double_digit_t>(n) * inverse);
+        inverse = static_cast<digit_t>(static_cast<double_digit_t>(inverse) * correction);
+    }
+    return static_cast<digit_t>(digit_t{0} - inverse);
+}
+
+bigint::BigInt truncate(const bigint::BigInt &x, std::size_t digits)
+{
+    const auto &data = x.raw_data();
+    return bigint::BigInt(std::span<digit_t const>(data.data(), std::min(digits, data.size())));
+}
+
+/// Compute -n^-1 mod 2^(digits * digit_bits) with Newton iteration, n must be odd.
+bigint::BigInt negated_inverse(const bigint::BigInt &n, std::size_t digits)
+{
+    bigint::BigInt inverse(static_cast<digit_t>(digit_t{0} - negated_digit_inverse(n.raw_data().front())));
+    for (std::size_t correct_digits = 1; correct_digits < digits;)
+    {
+        correct_digits *= 2;
+        const auto modulus = bigint::BigInt(1) << (correct_digits * digit_bits);
+        const auto error = truncate(truncate(n, correct_digits) * inverse, correct_digits);
+        inverse = truncate(inverse * (modulus + bigint::BigInt(2) - error), correct_digits);
+    }
+    return (bigint::BigInt(1) << (digits * digit_bits)) - truncate(inverse, digits);
+}
+
+/// Subtract n from t < 2n of k + 1 digits if t >= n, storing k digits of the result. Subtraction is always done and
+/// n is masked instead of branching on the comparison, so timing does not depend on t. Result may alias t.
+void subtract_modulus_consttime(const digit_t *t, const digit_t *n, std::size_t k, digit_t *result)
+{
+    digit_t borrow = 0;
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        const auto difference = static_cast<double_digit_t>(t[i]) - n[i] - borrow;
+        borrow = static_cast<digit_t>((difference >> digit_bits) & 1);
+    }
+
+    // t < n only if the subtraction borrows from the top digit, which is 0 or 1
+    const auto lower_than_n = static_cast<digit_t>(borrow & ~t[k] & 1);
+    const auto n_mask = static_cast<digit_t>(lower_than_n - 1);
+
+    borrow = 0;
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        const auto difference = static_cast<double_digit_t>(t[i]) - (n[i] & n_mask) - borrow;
+        result[i] = static_cast<digit_t>(difference);
+        borrow = static_cast<digit_t>((difference >> digit_bits) & 1);
+    }
+}
+
+/// Montgomery multiplication with interleaved reduction (CIOS) of k-digit operands lower than n.
+/// Scratch buffer t has k + 2 digits, result has k digits and may alias a or b.
+void montgomery_multiply_fixed(const digit_t *a, const digit_t *b, const digit_t *n, std::size_t k, digit_t n_prime,
+                               digit_t *t, digit_t *result)
+{
+    std::fill(t, t + k + 2, digit_t{0});
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        const auto a_i = static_cast<double_digit_t>(a[i]);
+        double_digit_t carry = 0;
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            const auto sum = static_cast<double_digit_t>(t[j] + a_i * b[j] + carry);
+            t[j] = static_cast<digit_t>(sum);
+            carry = sum >> digit_bits;
+        }
+        auto sum = static_cast<double_digit_t>(t[k] + carry);
+        t[k] = static_cast<digit_t>(sum);
+        t[k + 1] = static_cast<digit_t>(sum >> digit_bits);
+
+        const auto m = static_cast<double_digit_t>(static_cast<digit_t>(static_cast<double_digit_t>(t[0]) * n_prime));
+        carry = static_cast<double_digit_t>(t[0] + m * n[0]) >> digit_bits;
+        for (std::size_t j = 1; j < k; ++j)
+        {
+            sum = static_cast<double_digit_t>(t[j] + m * n[j] + carry);
+            t[j - 1] = static_cast<digit_t>(sum);
+            carry = sum >> digit_bits;
+        }
+        sum = static_cast<double_digit_t>(t[k] + carry);
+        t[k - 1] = static_cast<digit_t>(sum);
+        t[k] = static_cast<digit_t>(t[k + 1] + (sum >> digit_bits));
+        t[k + 1] = 0;
+    }
+    subtract_modulus_consttime(t, n, k, result);
+}
+
+/// Montgomery multiplication of operands lower than n.
+digits_t montgomery_multiply(const digits_t &a, const digits_t &b, const digits_t &n, digit_t n_prime)
+{
+    const std::size_t k = n.size();
+    digits_t x(a), y(b);
+    x.resize(k, 0);
+    y.resize(k, 0);
+
+    digits_t t(k + 2);
+    montgomery_multiply_fixed(x.data(), y.data(), n.data(), k, n_prime, t.data(), x.data());
+    trim(x);
+    return x;
+}
+
+/// Get number of bits of fixed window for constant-time exponentiation with exponent of given length.
+std::size_t consttime_window_bits(std::size_t exponent_bits)
+{
+    if (exponent_bits > 1024) return 6;
+    if (exponent_bits > 256) return 5;
+    if (exponent_bits > 64) return 4;
+    return 3;
+}
+
+/// Copy entry of the table to result, reading all entries, so memory access pattern does not depend on index.
+/// Inner loop consists of independent masked operations and is vectorized by the compiler.
+void select_consttime(const digits_t &table, std::size_t k, std::size_t index, digit_t *result)
+{
+    std::fill(result, result + k, digit_t{0});
+    for (std::size_t i = 0; i * k < table.size(); ++i)
+    {
+        const auto difference = static_cast<uint64_t>(i ^ index);
+        const auto mask = static_cast<digit_t>(((difference | (0 - difference)) >> 63) - 1);
+        const digit_t *entry = table.data() + i * k;
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            result[j] |= entry[j] & mask;
+        }
+    }
+}
+
+/// Get window of exponent digits starting at given bit, bits above the exponent are zero.
+std::size_t exponent_window(const digits_t &exponent, std::size_t first_bit, std::size_t window)
+{
+    std::size_t value = 0;
+    for (std::size_t i = 0; i < window; ++i)
+    {
+        const std::size_t bit = first_bit + i;
+        const std::size_t index = bit / digit_bits;
+        const auto digit = index < exponent.size() ? exponent[index] : digit_t{0};
+        value |= static_cast<std::size_t>((digit >> (bit % digit_bits)) & 1) << i;
+    }
+    return value;
+}
+
+}  // namespace
+
+MontgomeryContext::MontgomeryContext(const yabil::bigint::BigInt &modulus) : n(modulus)
+{
+    if (n.is_negative() || n.is_even() || n == yabil::bigint::BigInt(1))
+    {
+        throw std::invalid_argument("Montgomery modulus must be odd number greater than 1");
+    }
+
+    const std::size_t k = n.raw_data().size();
+    n_prime = negated_digit_inverse(n.raw_data().front());
+    r_mod_n = (yabil::bigint::BigInt(1) << (k * digit_bits)) % n;
+    r_squared = (r_mod_n * r_mod_n) % n;
+
+    if (k > montgomery_basecase_threshold_digits)
+    {
+        n_inverse = negated_inverse(n, k);
+    }
+}
+
+const yabil::bigint::BigInt &MontgomeryContext::modulus() const
+{
+    return n;
+}
+
+const yabil::bigint::BigInt &MontgomeryContext::one() const
+{
+    return r_mod_n;
+}
+
+yabil::bigint::BigInt MontgomeryContext::to_montgomery(const yabil::bigint::BigInt &x) const
+{
+    if (x.is_negative() || x >= n)
+    {
+        auto reduced = x % n;
+        return multiply(reduced.is_negative() ? reduced + n : reduced, r_squared);
+    }
+    return multiply(x, r_squared);
+}
+
+yabil::bigint::BigInt MontgomeryContext::from_montgomery(const yabil::bigint::BigInt &x) const
+{
+    return n_inverse.is_zero() ? multiply(x, yabil::bigint::BigInt(1)) : reduce(x);
+}
+
+yabil::bigint::BigInt MontgomeryContext::multiply(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &b) const
+{
+    if (n_inverse.is_zero())
+    {
+        return yabil::bigint::BigInt(montgomery_multiply(a.raw_data(), b.raw_data(), n.raw_data(), n_prime));
+    }
+    return reduce(a * b);
+}
+
+yabil::bigint::BigInt MontgomeryContext::square(const yabil::bigint::BigInt &a) const
+{
+    if (n_inverse.is_zero())
+    {
+        return multiply(a, a);
+    }
+    return reduce(a * a);
+}
+
+yabil::bigint::BigInt MontgomeryContext::pow(const yabil::bigint::BigInt &base,
+                                             const yabil::bigint::BigInt &exponent) const
+{
+    if (exponent.is_negative())
+    {
+        throw std::invalid_argument("Exponent must not be negative");
+    }
+
+    if (exponent.is_zero())
+    {
+        return r_mod_n;
+    }
+
+    const std::size_t bits = log2_int(exponent) + 1;
+    const std::size_t window = window_bits(bits);
+
+    // Odd powers base^1, base^3, ..., base^(2^window - 1)
+    std::vector<yabil::bigint::BigInt> odd_powers{base};
+    if (window > 1)
+    {
+        const auto base_squared = square(base);
+        for (std::size_t i = 1; i < (std::size_t{1} << (window - 1)); ++i)
+        {
+            odd_powers.push_back(multiply(odd_powers.back(), base_squared));
+        }
+    }
+
+    yabil::bigint::BigInt result;
+    bool started = false;
+    for (auto i = static_cast<int64_t>(bits) - 1; i >= 0;)
+    {
+        if (!exponent.get_bit(static_cast<std::size_t>(i)))
+        {
+            result = square(result);
+            --i;
+            continue;
+        }
+
+        // Longest window ending with set bit
+        auto j = std::max<int64_t>(i - static_cast<int64_t>(window) + 1, 0);
+        while (!exponent.get_bit(static_cast<std::size_t>(j)))
+        {
+            ++j;
+        }
+
+        std::size_t value = 0;
+        for (auto k = i; k >= j; --k)
+        {
+            value = (value << 1) | static_cast<std::size_t>(exponent.get_bit(static_cast<std::size_t>(k)));
+            if (started)
+            {
+                result = square(result);
+            }
+        }
+
+        result = started ? multiply(result, odd_powers[value >> 1]) : odd_powers[value >> 1];
+        started = true;
+        i = j - 1;
+    }
+    return result;
+}
+
+yabil::bigint::BigInt MontgomeryContext::pow_consttime(const yabil::bigint::BigInt &base,
+                                                       const yabil::bigint::BigInt &exponent) const
+{
+    if (exponent.is_negative())
+    {
+        throw std::invalid_argument("Exponent must not be negative");
+    }
+
+    const auto &modulus_digits = n.raw_data();
+    const auto &exponent_digits = exponent.raw_data();
+    const std::size_t k = modulus_digits.size();
+
+    // Only digit count of the exponent determines number of operations
+    const std::size_t exponent_bits = exponent_digits.size() * digit_bits;
+    const std::size_t window = consttime_window_bits(exponent_bits);
+
+    // Powers base^0, base^1, ..., base^(2^window - 1), each padded to k digits
+    digits_t table(k << window, 0);
+    std::copy(r_mod_n.raw_data().begin(), r_mod_n.raw_data().end(), table.begin());
+    std::copy(base.raw_data().begin(), base.raw_data().end(), table.begin() + static_cast<std::ptrdiff_t>(k));
+
+    digits_t t(k + 2);
+    for (std::size_t i = 2; i < (std::size_t{1} << window); ++i)
+    {
+        montgomery_multiply_fixed(&table[(i - 1) * k], &table[k], modulus_digits.data(), k, n_prime, t.data(),
+                                  &table[i * k]);
+    }
+
+    digits_t result(table.begin(), table.begin() + static_cast<std::ptrdiff_t>(k));
+    digits_t power(k);
+    for (std::size_t first_bit = (exponent_bits + window - 1) / window * window; first_bit > 0;)
+    {
+        first_bit -= window;
+        for (std::size_t i = 0; i < window; ++i)
+        {
+            montgomery_multiply_fixed(result.data(), result.data(), modulus_digits.data(), k, n_prime, t.data(),
+                                      result.data());
+        }
+        select_consttime(table, k, exponent_window(exponent_digits, first_bit, window), power.data());
+        montgomery_multiply_fixed(result.data(), power.data(), modulus_digits.data(), k, n_prime, t.data(),
+                                  result.data());
+    }
+    return yabil::bigint::BigInt(std::move(result));
+}
+
+yabil::bigint::BigInt MontgomeryContext::reduce(const yabil::bigint::BigInt &t) const
+{
+    const std::size_t k = n.raw_data().size();
+    const auto m = truncate(truncate(t, k) * n_inverse, k);
+    auto result = (t + m * n) >> (k * digit_bits);
+    if (result >= n)
+    {
+        result -= n;
+    }
+    return result;
+}
+
+}  // namespace yabil::math
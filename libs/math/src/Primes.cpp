@@ -0,0 +1,37 @@
+#include "Primes.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace yabil::math
+{
+
+std::vector<uint64_t> primes_up_to(uint64_t n)
+{
+    std::vector<uint64_t> primes;
+    if (n < 2)
+    {
+        return primes;
+    }
+
+    // Only odd numbers are stored: index i represents number 2 * i + 1
+    std::vector<bool> composite((n + 1) / 2, false);
+    for (uint64_t i = 1; (2 * i + 1) * (2 * i + 1) <= n; ++i)
+    {
+        if (composite[i]) continue;
+        const uint64_t p = 2 * i + 1;
+        for (uint64_t j = p * p / 2; j < composite.size(); j += p)
+        {
+            composite[j] = true;
+        }
+    }
+
+    primes.push_back(2);
+    for (uint64_t i = 1; i < composite.size(); ++i)
+    {
+        if (!composite[i]) primes.push_back(2 * i + 1);
+    }
+    return primes;
+}
+
+}  // namespace yabil::math
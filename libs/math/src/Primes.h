@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace yabil::math
+{
+
+/// Get all primes not greater than n (sieve of Eratosthenes).
+std::vector<uint64_t> primes_up_to(uint64_t n);
+
+}  // namespace yabil::math
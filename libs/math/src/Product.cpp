@@ -0,0 +1,100 @@
+#include "Product.h"
+
+#include <yabil/bigint/BigInt.h>
+#include <yabil/utils/ThreadPoolSingleton.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace yabil::math
+{
+
+namespace
+{
+
+// Minimal number of factors multiplied by single task of parallel product
+constexpr std::size_t parallel_product_min_chunk = 256;
+
+std::vector<bigint::BigInt> pack_factors(std::span<const uint64_t> factors)
+{
+    std::vector<bigint::BigInt> packed;
+    uint64_t word = 1;
+
+    for (const auto factor : factors)
+    {
+        if (factor != 0 && word > std::numeric_limits<uint64_t>::max() / factor)
+        {
+            packed.emplace_back(word);
+            word = 1;
+        }
+        word *= factor;
+    }
+
+    packed.emplace_back(word);
+    return packed;
+}
+
+}  // namespace
+
+bigint::BigInt product(std::span<const bigint::BigInt> numbers)
+{
+    if (numbers.empty())
+    {
+        return bigint::BigInt(1);
+    }
+
+    if (numbers.size() == 1)
+    {
+        return numbers.front();
+    }
+
+    if (numbers.size() == 2)
+    {
+        return numbers[0] * numbers[1];
+    }
+
+    const std::size_t middle = numbers.size() / 2;
+    return product(numbers.first(middle)) * product(numbers.subspan(middle));
+}
+
+bigint::BigInt product(std::span<const uint64_t> factors)
+{
+    const auto packed = pack_factors(factors);
+    return product(std::span<const bigint::BigInt>(packed));
+}
+
+bigint::BigInt parallel_product(std::span<const uint64_t> factors)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    const auto chunks = std::min(thread_pool.thread_count(), factors.size() / parallel_product_min_chunk);
+
+    if (chunks < 2 || thread_pool.is_current_thread_worker())
+    {
+        return product(factors);
+    }
+
+    std::vector<std::future<bigint::BigInt>> partial_results;
+    partial_results.reserve(chunks);
+
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        const auto begin = i * factors.size() / chunks;
+        const auto end = (i + 1) * factors.size() / chunks;
+        partial_results.push_back(
+            thread_pool.submit([chunk = factors.subspan(begin, end - begin)]() { return product(chunk); }));
+    }
+
+    std::vector<bigint::BigInt> partial_products;
+    partial_products.reserve(chunks);
+    for (auto &partial_result : partial_results)
+    {
+        partial_products.push_back(partial_result.get());
+    }
+    return product(std::span<const bigint::BigInt>(partial_products));
+}
+
+}  // namespace yabil::math
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <yabil/bigint/BigInt.h>
+
+#include <cstdint>
+#include <span>
+
+namespace yabil::math
+{
+
+/// Multiply all numbers using balanced product tree, so the largest multiplications have equal-sized operands.
+bigint::BigInt product(std::span<const bigint::BigInt> numbers);
+
+/// @copydoc product(std::span<const bigint::BigInt>)
+/// Factors are first packed into machine words.
+bigint::BigInt product(std::span<const uint64_t> factors);
+
+/// Multiply all factors, subtrees of the product tree are computed on the thread pool.
+bigint::BigInt parallel_product(std::span<const uint64_t> factors);
+
+}  // namespace yabil::math
@@ -0,0 +1,155 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/ProductTree.h>
+#include <yabil/utils/ThreadPoolSingleton.h>
+
+#include <algorithm>
+#include <future>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace yabil::math
+{
+
+namespace
+{
+
+// Minimal number of nodes computed by single task of parallel tree operations
+constexpr std::size_t parallel_tree_min_chunk = 16;
+
+/// Call function(begin, end) for ranges of indexes [0, size), concurrently when the range is wide enough.
+template <typename Function>
+void for_each_chunk(std::size_t size, bool use_threads, Function function)
+{
+    auto &thread_pool = utils::ThreadPoolSingleton::instance();
+    const auto chunks = std::min(thread_pool.thread_count(), size / parallel_tree_min_chunk);
+
+    if (!use_threads || chunks < 2 || thread_pool.is_current_thread_worker())
+    {
+        function(std::size_t{0}, size);
+        return;
+    }
+
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(chunks);
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        tasks.push_back(thread_pool.submit([&function, begin = i * size / chunks, end = (i + 1) * size / chunks]()
+                                           { function(begin, end); }));
+    }
+
+    for (auto &task : tasks)
+    {
+        task.get();
+    }
+}
+
+std::vector<std::vector<bigint::BigInt>> build_levels(std::span<const bigint::BigInt> numbers, bool use_threads)
+{
+    std::vector<std::vector<bigint::BigInt>> levels;
+    levels.emplace_back(numbers.begin(), numbers.end());
+
+    while (levels.back().size() > 1)
+    {
+        const auto &lower = levels.back();
+        std::vector<bigint::BigInt> upper((lower.size() + 1) / 2);
+
+        for_each_chunk(upper.size(), use_threads,
+                       [&](std::size_t begin, std::size_t end)
+                       {
+                           for (std::size_t j = begin; j < end; ++j)
+                           {
+                               upper[j] = 2 * j + 1 < lower.size() ? lower[2 * j] * lower[2 * j + 1] : lower[2 * j];
+                           }
+                       });
+        levels.push_back(std::move(upper));
+    }
+    return levels;
+}
+
+std::vector<bigint::BigInt> reduce_by_levels(const ProductTree &tree, const bigint::BigInt &x, bool use_threads)
+{
+    if (tree.size() == 0)
+    {
+        return {};
+    }
+
+    const auto &root = tree.product();
+    auto root_remainder = x.is_negative() || x >= root ? x % root : x;
+    if (root_remainder.is_negative())
+    {
+        root_remainder += root;
+    }
+
+    std::vector<bigint::BigInt> remainders{std::move(root_remainder)};
+    for (std::size_t i = tree.height() - 1; i > 0; --i)
+    {
+        const auto &nodes = tree.level(i - 1);
+        std::vector<bigint::BigInt> lower_remainders(nodes.size());
+
+        for_each_chunk(nodes.size(), use_threads,
+                       [&](std::size_t begin, std::size_t end)
+                       {
+                           for (std::size_t j = begin; j < end; ++j)
+                           {
+                               const auto &remainder = remainders[j / 2];
+                               lower_remainders[j] = remainder < nodes[j] ? remainder : remainder % nodes[j];
+                           }
+                       });
+        remainders = std::move(lower_remainders);
+    }
+    return remainders;
+}
+
+}  // namespace
+
+ProductTree::ProductTree(std::span<const yabil::bigint::BigInt> numbers) : levels(build_levels(numbers, false))
+{
+}
+
+ProductTree::ProductTree(std::vector<std::vector<yabil::bigint::BigInt>> levels) : levels(std::move(levels))
+{
+}
+
+const yabil::bigint::BigInt &ProductTree::product() const
+{
+    static const yabil::bigint::BigInt empty_product(1);
+    return levels.back().empty() ? empty_product : levels.back().front();
+}
+
+std::size_t ProductTree::size() const
+{
+    return levels.front().size();
+}
+
+std::size_t ProductTree::height() const
+{
+    return levels.size();
+}
+
+const std::vector<yabil::bigint::BigInt> &ProductTree::level(std::size_t index) const
+{
+    return levels.at(index);
+}
+
+std::vector<yabil::bigint::BigInt> ProductTree::remainder_tree(const yabil::bigint::BigInt &x) const
+{
+    return reduce_by_levels(*this, x, false);
+}
+
+namespace parallel
+{
+
+ProductTree product_tree(std::span<const yabil::bigint::BigInt> numbers)
+{
+    return ProductTree(build_levels(numbers, true));
+}
+
+std::vector<yabil::bigint::BigInt> remainder_tree(const ProductTree &tree, const yabil::bigint::BigInt &x)
+{
+    return reduce_by_levels(tree, x, true);
+}
+
+}  // namespace parallel
+
+}  // namespace yabil::math
@@ -0,0 +1,310 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Bits.h"
+#include "Primes.h"
+
+namespace yabil::math
+{
+
+namespace
+{
+
+using digit_t = bigint::bigint_base_t;
+
+constexpr std::size_t digit_bits = bigint::bigint_base_t_size_bits;
+
+// Roots up to this number of bits are seeded directly from floating point estimate
+constexpr uint64_t root_seed_bits = 32;
+
+// Number of residue tests used to reject exponent of perfect power candidate before calculating its root
+constexpr std::size_t perfect_power_sieve_size = 3;
+
+// Sieve moduli are primes lower than this value, so that product of them fits into 64 bits
+constexpr uint64_t perfect_power_sieve_max_modulus = 1 << 20;
+
+/// Get x mod 2^bits.
+bigint::BigInt low_bits(const bigint::BigInt &x, uint64_t bits)
+{
+    const auto &data = x.raw_data();
+    const std::size_t digits = std::min<std::size_t>((bits + digit_bits - 1) / digit_bits, data.size());
+    std::vector<digit_t> result(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(digits));
+
+    const std::size_t top_bits = bits % digit_bits;
+    if (top_bits != 0 && digits == (bits + digit_bits - 1) / digit_bits)
+    {
+        result.back() &= static_cast<digit_t>((digit_t{1} << top_bits) - 1);
+    }
+    return bigint::BigInt(std::move(result));
+}
+
+/// Square root of 64-bit number seeded with double precision estimate.
+uint64_t sqrt_uint64(uint64_t x)
+{
+    constexpr uint64_t max_root = 0xFFFFFFFFULL;
+    auto root = std::min(static_cast<uint64_t>(std::sqrt(static_cast<double>(x))), max_root);
+    while (root * root > x)
+    {
+        --root;
+    }
+    while (root < max_root && (root + 1) * (root + 1) <= x)
+    {
+        ++root;
+    }
+    return root;
+}
+
+/// Karatsuba square root (P. Zimmermann). Number must have exactly bits or bits - 1 bits, bits must be even.
+std::pair<bigint::BigInt, bigint::BigInt> sqrtrem_normalized(const bigint::BigInt &a, uint64_t bits)
+{
+    if (bits <= 64)
+    {
+        const uint64_t value = a.to_uint();
+        const uint64_t root = sqrt_uint64(value);
+        return {bigint::BigInt(root), bigint::BigInt(value - root * root)};
+    }
+
+    // a = a3 * 2^3k + a2 * 2^2k + a1 * 2^k + a0, (a3, a2) part keeps normalization of a
+    const uint64_t k = bits / 4;
+    const auto [high_root, high_remainder] = sqrtrem_normalized(a >> (2 * k), bits - 2 * k);
+    const auto a1 = low_bits(a >> k, k);
+    const auto a0 = low_bits(a, k);
+
+    const auto [q, u] = ((high_remainder << k) + a1).divide(high_root << 1);
+    auto root = (high_root << k) + q;
+    auto remainder = (u << k) + a0 - q * q;
+
+    if (remainder.is_negative())
+    {
+        remainder += (root << 1) - bigint::BigInt(1);
+        root -= bigint::BigInt(1);
+    }
+    return {std::move(root), std::move(remainder)};
+}
+
+/// Newton step for k-th root: (x * (k - 1) + n / x^(k - 1)) / k, where power = x^(k - 1).
+bigint::BigInt newton_root_step(const bigint::BigInt &n, uint64_t k, const bigint::BigInt &x,
+                                const bigint::BigInt &power)
+{
+    return (x * bigint::BigInt(k - 1) + n / power) / bigint::BigInt(k);
+}
+
+/// Calculate k-th root of n with Newton iteration starting from x >= floor(root(n, k)).
+/// Result of the Newton step is never lower than the root, so the iteration decreases until x^k <= n.
+/// Powers calculated to verify the result are reused by the next Newton step.
+std::pair<bigint::BigInt, bigint::BigInt> newton_rootrem(const bigint::BigInt &n, uint64_t k, bigint::BigInt x)
+{
+    while (true)
+    {
+        const auto power = pow(x, bigint::BigInt(k - 1));
+        auto remainder = n - power * x;
+        if (!remainder.is_negative())
+        {
+            return {std::move(x), std::move(remainder)};
+        }
+        x = newton_root_step(n, k, x, power);
+    }
+}
+
+/// Get estimate x >= floor(root(n, k)) with root_bits correct bits by doubling precision of root of top bits of n.
+bigint::BigInt root_estimate(const bigint::BigInt &n, uint64_t k, uint64_t root_bits)
+{
+    if (root_bits <= root_seed_bits)
+    {
+        // Result of Newton step is never below the root, even if the seed was
+        const bigint::BigInt seed(static_cast<uint64_t>(std::exp2(log2(n) / static_cast<double>(k))) + 1);
+        return newton_root_step(n, k, seed, pow(seed, bigint::BigInt(k - 1)));
+    }
+
+    // Error of Newton step from estimate with s wrong bits is about (k - 1) * 2^(2s - root_bits)
+    const uint64_t k_bits = static_cast<uint64_t>(std::bit_width(k));
+    const uint64_t shift = root_bits > k_bits + 2 ? (root_bits - k_bits - 2) / 2 : 0;
+    if (shift == 0)
+    {
+        return bigint::BigInt(1) << root_bits;
+    }
+
+    // floor(root(n >> ks, k)) == floor(root(n, k) >> s), so the estimate is above the root
+    const auto high_root = newton_rootrem(n >> (k * shift), k, root_estimate(n >> (k * shift), k, root_bits - shift));
+    const auto x = (high_root.first + bigint::BigInt(1)) << shift;
+    return newton_root_step(n, k, x, pow(x, bigint::BigInt(k - 1)));
+}
+
+/// Check if x is k-th power residue modulo small prime q, where k divides q - 1.
+bool is_power_residue(uint64_t x, uint64_t k, uint64_t q)
+{
+    x %= q;
+    if (x == 0)
+    {
+        return true;
+    }
+
+    uint64_t result = 1;
+    for (uint64_t exponent = (q - 1) / k; exponent > 0; exponent >>= 1)
+    {
+        if (exponent & 1) result = result * x % q;
+        x = x * x % q;
+    }
+    return result == 1;
+}
+
+bool is_small_prime(uint64_t n)
+{
+    for (uint64_t d = 2; d * d <= n; ++d)
+    {
+        if (n % d == 0) return false;
+    }
+    return n > 1;
+}
+
+/// Reject numbers which are not k-th powers, using residues modulo primes q = 1 (mod k).
+bool passes_power_sieve(const bigint::BigInt &n, uint64_t k)
+{
+    std::vector<uint64_t> moduli;
+    uint64_t moduli_product = 1;
+    for (uint64_t q = 2 * k + 1; q < perfect_power_sieve_max_modulus && moduli.size() < perfect_power_sieve_size;
+         q += 2 * k)
+    {
+        if (is_small_prime(q))
+        {
+            moduli.push_back(q);
+            moduli_product *= q;
+        }
+    }
+
+    if (moduli.empty())
+    {
+        return true;
+    }
+
+    const uint64_t residue = (n % bigint::BigInt(moduli_product)).to_uint();
+    return std::all_of(moduli.begin(), moduli.end(), [&](uint64_t q) { return is_power_residue(residue, k, q); });
+}
+
+}  // namespace
+
+std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt> sqrtrem(const yabil::bigint::BigInt &n)
+{
+    if (n.is_negative())
+    {
+        throw std::invalid_argument("Cannot calculate square root for negative integer");
+    }
+
+    if (n.is_zero())
+    {
+        return {bigint::BigInt(), bigint::BigInt()};
+    }
+
+    // Shift by even number of bits, so that one of two top bits of the 4k-bit block is set
+    const uint64_t length = bit_length(n);
+    const uint64_t bits = std::max<uint64_t>(4 * ((length + 3) / 4), 4);
+    const uint64_t shift = (bits - length) & ~uint64_t{1};
+
+    if (shift == 0)
+    {
+        return sqrtrem_normalized(n, bits);
+    }
+
+    // n * 2^shift = (root * 2^c + t)^2 + remainder, where c = shift / 2 and t < 2^c
+    const auto [root, remainder] = sqrtrem_normalized(n << shift, bits);
+    const uint64_t c = shift / 2;
+    const auto result = root >> c;
+    const auto t = low_bits(root, c);
+    return {result, (remainder + ((result * t) << (c + 1)) + t * t) >> shift};
+}
+
+yabil::bigint::BigInt sqrt(const yabil::bigint::BigInt &n)
+{
+    return sqrtrem(n).first;
+}
+
+std::pair<yabil::bigint::BigInt, yabil::bigint::BigInt> rootrem(const yabil::bigint::BigInt &n, uint64_t k)
+{
+    if (k == 0)
+    {
+        throw std::invalid_argument("Cannot calculate root of degree 0");
+    }
+
+    if (n.is_negative())
+    {
+        throw std::invalid_argument("Cannot calculate root for negative integer");
+    }
+
+    if (n.is_zero() || k == 1)
+    {
+        return {n, bigint::BigInt()};
+    }
+
+    if (k == 2)
+    {
+        return sqrtrem(n);
+    }
+
+    const uint64_t length = bit_length(n);
+    if (k >= length)
+    {
+        return {bigint::BigInt(1), n - bigint::BigInt(1)};
+    }
+
+    const uint64_t root_bits = (length - 1) / k + 1;
+    return newton_rootrem(n, k, root_estimate(n, k, root_bits));
+}
+
+yabil::bigint::BigInt root(const yabil::bigint::BigInt &n, uint64_t k)
+{
+    return rootrem(n, k).first;
+}
+
+yabil::bigint::BigInt root(const yabil::bigint::BigInt &n, const yabil::bigint::BigInt &k)
+{
+    if (k.is_negative() || k.is_zero())
+    {
+        throw std::invalid_argument("Degree of root must be positive");
+    }
+
+    // Degrees not fitting into 64 bits are greater than bit length of any number
+    if (bit_length(k) > 64)
+    {
+        return root(n, std::numeric_limits<uint64_t>::max());
+    }
+    return root(n, k.to_uint());
+}
+
+bool is_perfect_power(const yabil::bigint::BigInt &n)
+{
+    const auto magnitude = n.abs();
+    if (magnitude <= bigint::BigInt(1))
+    {
+        return true;
+    }
+
+    // Exponent of perfect power has to divide exponent of 2 in factorization of n
+    const uint64_t twos = trailing_zeros(magnitude);
+    const uint64_t length = bit_length(magnitude);
+
+    for (const auto p : primes_up_to(length - 1))
+    {
+        if ((p == 2 && n.is_negative()) || (twos != 0 && twos % p != 0) || !passes_power_sieve(magnitude, p))
+        {
+            continue;
+        }
+
+        if (rootrem(magnitude, p).second.is_zero())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace yabil::math
@@ -0,0 +1,222 @@
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace yabil::math
+{
+
+namespace
+{
+
+// Cipolla's algorithm is used instead of Tonelli-Shanks when s^2 > cipolla_factor * log2(p), where 2^s | p - 1,
+// since the latter needs about s^2 / 2 additional multiplications
+constexpr uint64_t cipolla_factor = 6;
+
+/// Element x + y * sqrt(w) of GF(p^2), both coordinates in Montgomery form.
+struct QuadraticElement
+{
+    bigint::BigInt x, y;
+};
+
+bigint::BigInt add_mod(bigint::BigInt a, const bigint::BigInt &b, const bigint::BigInt &p)
+{
+    a += b;
+    return a >= p ? a - p : a;
+}
+
+bigint::BigInt sub_mod(bigint::BigInt a, const bigint::BigInt &b, const bigint::BigInt &p)
+{
+    a -= b;
+    return a.is_negative() ? a + p : a;
+}
+
+/// Square root for p = 3 (mod 4): a^((p + 1) / 4).
+bigint::BigInt sqrt_3_mod_4(const MontgomeryContext &context, const bigint::BigInt &a)
+{
+    return context.pow(a, (context.modulus() + bigint::BigInt(1)) >> 2);
+}
+
+/// Square root for p = 5 (mod 8) (Atkin): v = (2a)^((p - 5) / 8), i = 2av^2, root = av(i - 1).
+bigint::BigInt sqrt_5_mod_8(const MontgomeryContext &context, const bigint::BigInt &a)
+{
+    const auto &p = context.modulus();
+    const auto two_a = add_mod(a, a, p);
+    const auto v = context.pow(two_a, p >> 3);
+    const auto i = context.multiply(two_a, context.square(v));
+    return context.multiply(context.multiply(a, v), sub_mod(i, context.one(), p));
+}
+
+/// Tonelli-Shanks algorithm, p - 1 = q * 2^s with odd q.
+bigint::BigInt tonelli_shanks(const MontgomeryContext &context, const bigint::BigInt &a, const bigint::BigInt &q,
+                              uint64_t s)
+{
+    const auto &p = context.modulus();
+
+    // Non-residue exists for every p which is not a perfect square, so it is found for every odd prime
+    bigint::BigInt z(2);
+    for (; jacobi(z, p) != -1; ++z)
+    {
+        if (z >= p)
+        {
+            throw std::invalid_argument("Modulus must be prime");
+        }
+    }
+
+    auto c = context.pow(context.to_montgomery(z), q);
+    const auto a_to_half_q = context.pow(a, q >> 1);
+    auto root = context.multiply(a_to_half_q, a);
+    auto t = context.multiply(a_to_half_q, root);
+
+    while (t != context.one())
+    {
+        // Least i, such that t^(2^i) = 1
+        uint64_t i = 0;
+        for (auto t_power = t; t_power != context.one(); t_power = context.square(t_power))
+        {
+            if (++i == s)
+            {
+                throw std::invalid_argument("Modulus must be prime");
+            }
+        }
+
+        auto b = std::move(c);
+        for (uint64_t j = i + 1; j < s; ++j)
+        {
+            b = context.square(b);
+        }
+
+        root = context.multiply(root, b);
+        c = context.square(b);
+        t = context.multiply(t, c);
+        s = i;
+    }
+    return root;
+}
+
+/// Cipolla's algorithm: for t such that w = t^2 - a is a non-residue, root = (t + sqrt(w))^((p + 1) / 2).
+bigint::BigInt cipolla(const MontgomeryContext &context, const bigint::BigInt &a)
+{
+    const auto &p = context.modulus();
+
+    bigint::BigInt t;
+    bigint::BigInt w;
+    for (bigint::BigInt i(1);; ++i)
+    {
+        if (i >= p)
+        {
+            throw std::invalid_argument("Modulus must be prime");
+        }
+
+        t = context.to_montgomery(i);
+        w = sub_mod(context.square(t), a, p);
+        if (jacobi(context.from_montgomery(w), p) == -1)
+        {
+            break;
+        }
+    }
+
+    // (x + y * sqrt(w))^2 = x^2 + y^2 * w + ((x + y)^2 - x^2 - y^2) * sqrt(w)
+    const auto square = [&](const QuadraticElement &u)
+    {
+        const auto xx = context.square(u.x);
+        const auto yy = context.square(u.y);
+        const auto cross = sub_mod(sub_mod(context.square(add_mod(u.x, u.y, p)), xx, p), yy, p);
+        return QuadraticElement{add_mod(xx, context.multiply(yy, w), p), cross};
+    };
+
+    // (x + y * sqrt(w)) * (t + sqrt(w)) = x * t + y * w + (x + y * t) * sqrt(w)
+    const auto multiply_by_base = [&](const QuadraticElement &u)
+    {
+        return QuadraticElement{add_mod(context.multiply(u.x, t), context.multiply(u.y, w), p),
+                                add_mod(u.x, context.multiply(u.y, t), p)};
+    };
+
+    const auto exponent = (p + bigint::BigInt(1)) >> 1;
+    QuadraticElement result{t, context.one()};
+    for (auto bit = static_cast<int64_t>(log2_int(exponent)) - 1; bit >= 0; --bit)
+    {
+        result = square(result);
+        if (exponent.get_bit(static_cast<std::size_t>(bit)))
+        {
+            result = multiply_by_base(result);
+        }
+    }
+    return result.x;
+}
+
+}  // namespace
+
+yabil::bigint::BigInt sqrt_mod(const yabil::bigint::BigInt &a, const yabil::bigint::BigInt &p)
+{
+    if (p.is_negative() || p.is_zero() || p == yabil::bigint::BigInt(1))
+    {
+        throw std::invalid_argument("Modulus must be prime");
+    }
+
+    auto reduced = a % p;
+    if (reduced.is_negative())
+    {
+        reduced += p;
+    }
+
+    if (p == yabil::bigint::BigInt(2) || reduced.is_zero())
+    {
+        return reduced;
+    }
+
+    if (p.is_even())
+    {
+        throw std::invalid_argument("Modulus must be prime");
+    }
+
+    if (jacobi(reduced, p) != 1)
+    {
+        throw std::runtime_error("Number is not a quadratic residue modulo p");
+    }
+
+    const MontgomeryContext context(p);
+    const auto a_montgomery = context.to_montgomery(reduced);
+    const auto p_minus_1 = p - yabil::bigint::BigInt(1);
+
+    yabil::bigint::BigInt root;
+    if (p.get_bit(1))
+    {
+        root = sqrt_3_mod_4(context, a_montgomery);
+    }
+    else if (p.get_bit(2))
+    {
+        root = sqrt_5_mod_8(context, a_montgomery);
+    }
+    else
+    {
+        uint64_t s = 0;
+        while (!p_minus_1.get_bit(s))
+        {
+            ++s;
+        }
+
+        if (s * s > cipolla_factor * (log2_int(p) + 1))
+        {
+            root = cipolla(context, a_montgomery);
+        }
+        else
+        {
+            root = tonelli_shanks(context, a_montgomery, p_minus_1 >> s, s);
+        }
+    }
+
+    if (context.square(root) != a_montgomery)
+    {
+        throw std::invalid_argument("Modulus must be prime");
+    }
+
+    root = context.from_montgomery(root);
+    auto other_root = p - root;
+    return other_root < root ? other_root : root;
+}
+
+}  // namespace yabil::math
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Parallel.h>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathBatchModInverse_tests : public ::testing::Test
+{
+};
+
+TEST_F(MathBatchModInverse_tests, batchOfNoNumbersIsEmpty)
+{
+    EXPECT_TRUE(batch_mod_inverse({}, BigInt(7)).empty());
+    EXPECT_TRUE(parallel::batch_mod_inverse({}, BigInt(7)).empty());
+}
+
+TEST_F(MathBatchModInverse_tests, batchModInverseForSmallPrime)
+{
+    const std::vector<BigInt> numbers = {BigInt(3), BigInt(1), BigInt(-3), BigInt(13), BigInt(6)};
+    const std::vector<BigInt> expected = {BigInt(5), BigInt(1), BigInt(2), BigInt(6), BigInt(6)};
+
+    EXPECT_EQ(expected, batch_mod_inverse(numbers, BigInt(7)));
+}
+
+TEST_F(MathBatchModInverse_tests, batchModInverseForEvenModulus)
+{
+    const std::vector<BigInt> numbers = {BigInt(3), BigInt(5), BigInt(7), BigInt(11)};
+    const BigInt n = BigInt(1) << 100;
+
+    const auto inverses = batch_mod_inverse(numbers, n);
+    ASSERT_EQ(numbers.size(), inverses.size());
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+    {
+        EXPECT_EQ(mod_inverse(numbers[i], n), inverses[i]);
+    }
+}
+
+TEST_F(MathBatchModInverse_tests, batchModInverseThrowsForNotInvertibleNumber)
+{
+    const std::vector<BigInt> numbers = {BigInt(5), BigInt(4), BigInt(7)};
+    const std::vector<BigInt> zero = {BigInt(5), BigInt(14)};
+
+    ASSERT_THROW({ batch_mod_inverse(numbers, BigInt(6)); }, std::runtime_error);
+    ASSERT_THROW({ batch_mod_inverse(zero, BigInt(7)); }, std::runtime_error);
+    ASSERT_THROW({ batch_mod_inverse(numbers, BigInt()); }, std::invalid_argument);
+}
+
+TEST_F(MathBatchModInverse_tests, parallelBatchModInverseForBigPrime)
+{
+    const BigInt n = (BigInt(1) << 1279) - BigInt(1);
+    std::vector<BigInt> numbers;
+    for (int i = 1; i <= 500; ++i)
+    {
+        numbers.push_back(pow(BigInt(i + 1), BigInt(400 + i)));
+    }
+
+    const auto inverses = parallel::batch_mod_inverse(numbers, n);
+    EXPECT_EQ(batch_mod_inverse(numbers, n), inverses);
+
+    ASSERT_EQ(numbers.size(), inverses.size());
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+    {
+        EXPECT_EQ(BigInt(1), (numbers[i] * inverses[i]) % n);
+    }
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/BinarySplitting.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Parallel.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathBinarySplitting_tests : public ::testing::Test
+{
+};
+
+TEST_F(MathBinarySplitting_tests, emptyRangeGivesNeutralResult)
+{
+    const HypergeometricSeries series{[](uint64_t) { return BigInt(2); }, [](uint64_t) { return BigInt(3); },
+                                      [](uint64_t) { return BigInt(1); }};
+    const auto result = binary_splitting(series, 5, 5);
+
+    EXPECT_EQ(BigInt(1), result.P);
+    EXPECT_EQ(BigInt(1), result.Q);
+    EXPECT_EQ(BigInt(0), result.T);
+}
+
+TEST_F(MathBinarySplitting_tests, geometricSeries)
+{
+    // sum of (1/2)^k for k in [1, 10] = 1023 / 1024
+    const HypergeometricSeries series{[](uint64_t) { return BigInt(1); }, [](uint64_t) { return BigInt(2); },
+                                      [](uint64_t) { return BigInt(1); }};
+    const auto result = binary_splitting(series, 1, 11);
+
+    EXPECT_EQ(BigInt(1), result.P);
+    EXPECT_EQ(BigInt(1024), result.Q);
+    EXPECT_EQ(BigInt(1023), result.T);
+}
+
+TEST_F(MathBinarySplitting_tests, parallelBinarySplittingMatchesSerial)
+{
+    const HypergeometricSeries series{[](uint64_t k) { return BigInt(2 * k + 1); },
+                                      [](uint64_t k) { return BigInt(3 * k + 7); },
+                                      [](uint64_t k) { return BigInt(k) - BigInt(50); }};
+    const auto result = binary_splitting(series, 0, 1000);
+    const auto parallel_result = parallel::binary_splitting(series, 0, 1000);
+
+    EXPECT_EQ(result.P, parallel_result.P);
+    EXPECT_EQ(result.Q, parallel_result.Q);
+    EXPECT_EQ(result.T, parallel_result.T);
+}
+
+TEST_F(MathBinarySplitting_tests, piDigits)
+{
+    EXPECT_EQ(BigInt(3), pi(0));
+    EXPECT_EQ(BigInt(314159), pi(5));
+    EXPECT_EQ(BigInt("314159265358979323846264338327950288419716939937510"
+                     "58209749445923078164062862089986280348253421170679"),
+              pi(100));
+    EXPECT_TRUE(pi(1000).to_str().ends_with("66111959092164201989"));
+    EXPECT_EQ(pi(1000), parallel::pi(1000));
+}
+
+TEST_F(MathBinarySplitting_tests, eDigits)
+{
+    EXPECT_EQ(BigInt(2), e(0));
+    EXPECT_EQ(BigInt(271828), e(5));
+    EXPECT_EQ(BigInt("271828182845904523536028747135266249775724709369995"
+                     "95749669676277240766303535475945713821785251664274"),
+              e(100));
+    EXPECT_TRUE(e(1000).to_str().ends_with("12671546889570350354"));
+    EXPECT_EQ(e(1000), parallel::e(1000));
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathCombinatorics_tests : public ::testing::Test
+{
+};
+
+TEST_F(MathCombinatorics_tests, binomialOfSmallNumbers)
+{
+    EXPECT_EQ(BigInt(1), binomial(0, 0));
+    EXPECT_EQ(BigInt(1), binomial(10, 0));
+    EXPECT_EQ(BigInt(10), binomial(10, 9));
+    EXPECT_EQ(BigInt(252), binomial(10, 5));
+    EXPECT_EQ(BigInt(0), binomial(5, 6));
+    EXPECT_EQ(BigInt(166167000), binomial(1000, 3));
+    EXPECT_EQ(BigInt("100891344545564193334812497256"), binomial(100, 50));
+}
+
+TEST_F(MathCombinatorics_tests, binomialMatchesFactorials)
+{
+    for (const uint64_t k : {1, 17, 500, 1234, 1999})
+    {
+        EXPECT_EQ(factorial(2000) / (factorial(k) * factorial(2000 - k)), binomial(2000, k));
+    }
+}
+
+TEST_F(MathCombinatorics_tests, binomialOfHugeSetWithSmallSubset)
+{
+    EXPECT_EQ(BigInt("499999999500000000"), binomial(1000000000, 2));
+    EXPECT_EQ(BigInt("499999999500000000"), binomial(1000000000, 999999998));
+
+    const BigInt n = BigInt(1) << 44;
+    EXPECT_EQ(n * (n - BigInt(1)) / BigInt(2), binomial(uint64_t{1} << 44, 2));
+
+    const BigInt max(std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(max * (max - BigInt(1)) * (max - BigInt(2)) / BigInt(6),
+              binomial(std::numeric_limits<uint64_t>::max(), 3));
+
+    // Subset sizes around the switch between the falling product and prime factorization
+    for (const uint64_t k : {100, 184, 185, 300})
+    {
+        EXPECT_EQ(factorial(10000) / (factorial(k) * factorial(10000 - k)), binomial(10000, k));
+    }
+}
+
+TEST_F(MathCombinatorics_tests, multinomialWithDominatingPart)
+{
+    const uint64_t m = uint64_t{1} << 44;
+    const BigInt n = BigInt(m) + BigInt(3);
+    EXPECT_EQ(n * (n - BigInt(1)) * (n - BigInt(2)) / BigInt(2), multinomial(std::vector<uint64_t>{2, m, 1}));
+    EXPECT_EQ(binomial(10000, 100) * binomial(100, 40), multinomial(std::vector<uint64_t>{9900, 40, 60}));
+}
+
+TEST_F(MathCombinatorics_tests, multinomialOfSmallNumbers)
+{
+    EXPECT_EQ(BigInt(1), multinomial(std::vector<uint64_t>{}));
+    EXPECT_EQ(BigInt(1), multinomial(std::vector<uint64_t>{7}));
+    EXPECT_EQ(binomial(50, 20), multinomial(std::vector<uint64_t>{20, 30}));
+    EXPECT_EQ(BigInt("2329089562800"), multinomial(std::vector<uint64_t>{10, 7, 13}));
+}
+
+TEST_F(MathCombinatorics_tests, multinomialWithTooBigSumShouldThrow)
+{
+    const std::vector<uint64_t> k = {std::numeric_limits<uint64_t>::max(), 1};
+    ASSERT_THROW({ multinomial(k); }, std::invalid_argument);
+}
+
+TEST_F(MathCombinatorics_tests, primorialOfSmallNumbers)
+{
+    EXPECT_EQ(BigInt(1), primorial(0));
+    EXPECT_EQ(BigInt(1), primorial(1));
+    EXPECT_EQ(BigInt(2), primorial(2));
+    EXPECT_EQ(BigInt(30), primorial(6));
+    EXPECT_EQ(BigInt("2305567963945518424753102147331756070"), primorial(100));
+}
+
+TEST_F(MathCombinatorics_tests, doubleFactorialOfSmallNumbers)
+{
+    EXPECT_EQ(BigInt(1), double_factorial(0));
+    EXPECT_EQ(BigInt(1), double_factorial(1));
+    EXPECT_EQ(BigInt(15), double_factorial(5));
+    EXPECT_EQ(BigInt(48), double_factorial(6));
+    EXPECT_EQ(BigInt("7905853580625"), double_factorial(25));
+    EXPECT_EQ(BigInt("42849873690624000"), double_factorial(30));
+}
+
+TEST_F(MathCombinatorics_tests, doubleFactorialsOfNeighboursMultiplyToFactorial)
+{
+    for (const uint64_t n : {100, 1001, 5000})
+    {
+        EXPECT_EQ(factorial(n), double_factorial(n) * double_factorial(n - 1));
+    }
+}
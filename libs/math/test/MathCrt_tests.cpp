@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/CrtBasis.h>
+#include <yabil/math/Math.h>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathCrt_tests : public ::testing::Test
+{
+};
+
+TEST_F(MathCrt_tests, basisOfInvalidModuliShouldThrow)
+{
+    ASSERT_THROW({ CrtBasis basis(std::vector<BigInt>{BigInt(3), BigInt(0)}); }, std::invalid_argument);
+    ASSERT_THROW({ CrtBasis basis(std::vector<BigInt>{BigInt(3), BigInt(-5)}); }, std::invalid_argument);
+    ASSERT_THROW({ CrtBasis basis(std::vector<BigInt>{BigInt(6), BigInt(5), BigInt(9)}); }, std::invalid_argument);
+}
+
+TEST_F(MathCrt_tests, wrongNumberOfResiduesShouldThrow)
+{
+    const CrtBasis basis(std::vector<BigInt>{BigInt(3), BigInt(5)});
+    ASSERT_THROW({ crt(std::vector<BigInt>{BigInt(1)}, basis); }, std::invalid_argument);
+}
+
+TEST_F(MathCrt_tests, basisKeepsModuliProductAndInverses)
+{
+    const std::vector<BigInt> moduli = {BigInt(3), BigInt(5), BigInt(7)};
+    const CrtBasis basis(moduli);
+
+    EXPECT_EQ(3, basis.size());
+    EXPECT_EQ(moduli, basis.moduli());
+    EXPECT_EQ(BigInt(105), basis.modulus());
+    EXPECT_EQ(std::vector<BigInt>({BigInt(2), BigInt(1), BigInt(1)}), basis.inverses());
+}
+
+TEST_F(MathCrt_tests, crtOfSmallNumbers)
+{
+    const CrtBasis basis(std::vector<BigInt>{BigInt(3), BigInt(5), BigInt(7)});
+
+    EXPECT_EQ(BigInt(23), crt(std::vector<BigInt>{BigInt(2), BigInt(3), BigInt(2)}, basis));
+    EXPECT_EQ(BigInt(0), crt(std::vector<BigInt>{BigInt(0), BigInt(0), BigInt(0)}, basis));
+    EXPECT_EQ(BigInt(104), crt(std::vector<BigInt>{BigInt(-1), BigInt(-1), BigInt(13)}, basis));
+}
+
+TEST_F(MathCrt_tests, crtWithSingleModulus)
+{
+    const CrtBasis basis(std::vector<BigInt>{BigInt(1000003)});
+    EXPECT_EQ(BigInt(3), crt(std::vector<BigInt>{BigInt(2000009)}, basis));
+}
+
+TEST_F(MathCrt_tests, basisCanBeReusedForManyReconstructions)
+{
+    std::vector<BigInt> moduli;
+    for (int i = 0; i < 101; ++i)
+    {
+        moduli.push_back((BigInt(1) << 127) - BigInt(1) + BigInt(2 * i + 2) * BigInt(i + 1));
+    }
+
+    // Moduli are made pairwise coprime by removing common factors
+    for (std::size_t i = 0; i < moduli.size(); ++i)
+    {
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            for (auto g = gcd(moduli[i], moduli[j]); g != BigInt(1); g = gcd(moduli[i], moduli[j]))
+            {
+                moduli[i] /= g;
+            }
+        }
+    }
+
+    const CrtBasis basis(moduli);
+    for (const auto &x : {BigInt(0), BigInt(12345), pow(BigInt(3), BigInt(5000)), basis.modulus() - BigInt(1)})
+    {
+        std::vector<BigInt> residues;
+        for (const auto &modulus : moduli)
+        {
+            residues.push_back(x % modulus);
+        }
+        EXPECT_EQ(x % basis.modulus(), crt(residues, basis));
+    }
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <yabil/bigint/BigInt.h>
 #include <yabil/math/Math.h>
+#include <yabil/math/Parallel.h>
 
 using namespace yabil::math;
 
@@ -82,3 +83,24 @@ TEST_F(MathFactorial_tests, factorialOf985)
             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000"));
 }
+
+TEST_F(MathFactorial_tests, factorialMatchesProductOfConsecutiveNumbers)
+{
+    yabil::bigint::BigInt expected(1);
+    for (uint64_t n = 1; n <= 3000; ++n)
+    {
+        expected *= yabil::bigint::BigInt(n);
+        if (n <= 300 || n % 97 == 0)
+        {
+            EXPECT_EQ(expected, factorial(n));
+        }
+    }
+}
+
+TEST_F(MathFactorial_tests, parallelFactorialMatchesFactorial)
+{
+    for (const uint64_t n : {0, 1, 2, 3, 10, 1000, 20000})
+    {
+        EXPECT_EQ(factorial(n), parallel::factorial(n));
+    }
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathFibonacci_tests : public ::testing::Test
+{
+};
+
+TEST_F(MathFibonacci_tests, fibonacciOfSmallNumbers)
+{
+    BigInt previous(1), current(0);
+    for (uint64_t n = 0; n < 200; ++n)
+    {
+        EXPECT_EQ(current, fibonacci(n));
+        previous = previous + current;
+        std::swap(previous, current);
+    }
+}
+
+TEST_F(MathFibonacci_tests, fibonacciOfBigNumbers)
+{
+    EXPECT_EQ(BigInt("354224848179261915075"), fibonacci(100));
+    EXPECT_EQ(BigInt("222232244629420445529739893461909967206666939096499764990979600"), fibonacci(300));
+}
+
+TEST_F(MathFibonacci_tests, lucasNumbers)
+{
+    const uint64_t expected[] = {2, 1, 3, 4, 7, 11, 18, 29, 47, 76};
+    for (uint64_t n = 0; n < 10; ++n)
+    {
+        EXPECT_EQ(BigInt(expected[n]), lucas(n));
+    }
+    EXPECT_EQ(BigInt("792070839848372253127"), lucas(100));
+}
+
+TEST_F(MathFibonacci_tests, fibonacciTimesLucasIsFibonacciOfDoubledIndex)
+{
+    for (const uint64_t n : {1, 2, 3, 50, 1001, 20000, 65537})
+    {
+        EXPECT_EQ(fibonacci(2 * n), fibonacci(n) * lucas(n));
+    }
+}
+
+TEST_F(MathFibonacci_tests, fibonacciModMatchesFibonacci)
+{
+    const BigInt moduli[] = {BigInt(2),
+                             BigInt(10),
+                             BigInt(1000000007),
+                             BigInt("18446744073709551616"),
+                             BigInt("1000000000000000000000000001234"),
+                             BigInt("340282366920938463463374607431768211507")};
+    for (const auto &m : moduli)
+    {
+        for (const uint64_t n : {1, 2, 3, 99, 100, 300, 4097})
+        {
+            EXPECT_EQ(fibonacci(n) % m, fibonacci_mod(BigInt(n), m));
+        }
+    }
+
+    EXPECT_EQ(BigInt(644264086), fibonacci_mod(BigInt(300), BigInt(1000000007)));
+    EXPECT_EQ(BigInt("377333962109312800736797388650"),
+              fibonacci_mod(BigInt(300), BigInt("1000000000000000000000000001234")));
+}
+
+TEST_F(MathFibonacci_tests, fibonacciModOfHugeIndex)
+{
+    // Pisano period for modulus 10 is 60 and 10^30 = 40 (mod 60)
+    EXPECT_EQ(BigInt(5), fibonacci_mod(BigInt("1000000000000000000000000000000"), BigInt(10)));
+    EXPECT_EQ(fibonacci(40) % BigInt(1000000007),
+              fibonacci_mod(BigInt(40) + BigInt(2000000016) * BigInt(123456789), BigInt(1000000007)));
+}
+
+TEST_F(MathFibonacci_tests, fibonacciModOfTrivialArguments)
+{
+    EXPECT_EQ(BigInt(0), fibonacci_mod(BigInt(0), BigInt(7)));
+    EXPECT_EQ(BigInt(0), fibonacci_mod(BigInt(12345), BigInt(1)));
+    EXPECT_EQ(BigInt(1), fibonacci_mod(BigInt(1), BigInt(7)));
+}
+
+TEST_F(MathFibonacci_tests, fibonacciModThrowsOnInvalidArguments)
+{
+    EXPECT_THROW(fibonacci_mod(BigInt(-1), BigInt(7)), std::invalid_argument);
+    EXPECT_THROW(fibonacci_mod(BigInt(10), BigInt(0)), std::invalid_argument);
+    EXPECT_THROW(fibonacci_mod(BigInt(10), BigInt(-7)), std::invalid_argument);
+}
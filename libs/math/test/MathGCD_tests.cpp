@@ -3,6 +3,7 @@
 #include <yabil/math/Math.h>
 
 #include <limits>
+#include <utility>
 
 using namespace yabil::math;
 using namespace yabil::bigint;
@@ -38,6 +39,67 @@ TEST_F(MathGCD_tests, gcdForBigIntegers)
     EXPECT_EQ(BigInt(7), gcd(BigInt("921873891238712039127327381239"), BigInt("128379128371298371982372983781")));
 }
 
+TEST_F(MathGCD_tests, gcdOfNegativeNumbersIsPositive)
+{
+    EXPECT_EQ(BigInt(14), gcd(BigInt(-42), BigInt(56)));
+    EXPECT_EQ(BigInt(14), gcd(BigInt(-42), BigInt(-56)));
+}
+
+TEST_F(MathGCD_tests, gcdForMediumIntegers)
+{
+    const BigInt common = pow(BigInt(7), BigInt(150));
+    const BigInt a = pow(BigInt(3), BigInt(400)) * common;
+    const BigInt b = pow(BigInt(5), BigInt(300)) * common;
+
+    EXPECT_EQ(common, gcd(a, b));
+    EXPECT_EQ(common, gcd(b, a));
+    EXPECT_EQ(common << 17, gcd(a << 17, b << 20));
+}
+
+TEST_F(MathGCD_tests, gcdForSmallIntegersWithDifferentParity)
+{
+    const BigInt common = pow(BigInt(13), BigInt(30));
+    const BigInt a = pow(BigInt(3), BigInt(50)) * common;
+    const BigInt b = pow(BigInt(2), BigInt(90)) * pow(BigInt(5), BigInt(20)) * common;
+
+    EXPECT_EQ(common, gcd(a, b));
+    EXPECT_EQ(common, gcd(b, a));
+    EXPECT_EQ(common, gcd(a, b << 3));
+    EXPECT_EQ(BigInt(1), gcd(a + BigInt(1), a));
+    EXPECT_EQ(a, gcd(a, a * BigInt(12)));
+}
+
+TEST_F(MathGCD_tests, gcdForNumbersWithLargeQuotient)
+{
+    const BigInt common = pow(BigInt(11), BigInt(40));
+    const BigInt a = (pow(BigInt(3), BigInt(2000)) + BigInt(1)) * common;
+    const BigInt b = BigInt(1234567) * common;
+
+    EXPECT_EQ(common, gcd(a, b));
+}
+
+TEST_F(MathGCD_tests, gcdOfConsecutiveFibonacciNumbersIsOne)
+{
+    BigInt f0(0), f1(1);
+    for (int i = 0; i < 3000; ++i)
+    {
+        f0 = std::exchange(f1, f0 + f1);
+    }
+
+    EXPECT_EQ(BigInt(1), gcd(f0, f1));
+    EXPECT_EQ(f0, gcd(f0 * f1, f0 * (f1 + f0)));
+}
+
+TEST_F(MathGCD_tests, gcdForHugeIntegers)
+{
+    const BigInt common = pow(BigInt(7), BigInt(5000));
+    const BigInt a = pow(BigInt(3), BigInt(40000)) * common;
+    const BigInt b = pow(BigInt(5), BigInt(30000)) * common;
+
+    EXPECT_EQ(common, gcd(a, b));
+    EXPECT_EQ(common * BigInt(9), gcd(a * BigInt(9), b * BigInt(18)));
+}
+
 TEST_F(MathGCD_tests, extendedGCDOfZeroAndZeroIsZero)
 {
     const auto result = extended_gcd(BigInt(), BigInt());
@@ -103,3 +165,30 @@ TEST_F(MathGCD_tests, extendedGCDWorks)
         EXPECT_EQ(-15309, y.to_int());
     }
 }
+
+TEST_F(MathGCD_tests, extendedGCDSatisfiesBezoutIdentityForBigIntegers)
+{
+    const BigInt common = pow(BigInt(7), BigInt(200));
+    for (const uint64_t exponent : {300, 3000, 12000})
+    {
+        const BigInt a = pow(BigInt(3), BigInt(exponent)) * common;
+        const BigInt b = (pow(BigInt(5), BigInt(exponent)) + BigInt(2)) * common;
+        const auto result = extended_gcd(a, b);
+        const auto& [x, y] = result.second;
+
+        EXPECT_EQ(gcd(a, b), result.first);
+        EXPECT_EQ(result.first, x * a + y * b);
+        EXPECT_LE(x << 1, b / result.first);
+        EXPECT_LE(y << 1, a / result.first);
+    }
+}
+
+TEST_F(MathGCD_tests, extendedGCDOfNegativeNumbers)
+{
+    const auto result = extended_gcd(BigInt(-42), BigInt(56));
+    const auto& [x, y] = result.second;
+
+    EXPECT_EQ(14, result.first.to_int());
+    EXPECT_EQ(1, x.to_int());
+    EXPECT_EQ(1, y.to_int());
+}
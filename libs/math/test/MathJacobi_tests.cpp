@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathJacobi_tests : public ::testing::Test
+{
+};
+
+namespace
+{
+
+/// Jacobi symbol for odd prime p from Euler's criterion.
+int euler_criterion(const BigInt &a, const BigInt &p)
+{
+    const auto power = pow(a, (p - BigInt(1)) >> 1, p);
+    if (power.is_zero()) return 0;
+    return power == BigInt(1) ? 1 : -1;
+}
+
+}  // namespace
+
+TEST_F(MathJacobi_tests, jacobiOfSmallNumbers)
+{
+    // Row n = 15 of the table of Jacobi symbols
+    const int expected[] = {0, 1, 1, 0, 1, 0, 0, -1, 1, 0, 0, -1, 0, -1, -1};
+    for (int a = 0; a < 15; ++a)
+    {
+        EXPECT_EQ(expected[a], jacobi(BigInt(a), BigInt(15)));
+        EXPECT_EQ(expected[a], jacobi(BigInt(a + 15 * 1000), BigInt(15)));
+        EXPECT_EQ(expected[a], jacobi(BigInt(a - 15 * 1000), BigInt(15)));
+    }
+
+    EXPECT_EQ(1, jacobi(BigInt(0), BigInt(1)));
+    EXPECT_EQ(-1, jacobi(BigInt(1001), BigInt(9907)));
+    EXPECT_EQ(1, jacobi(BigInt(19), BigInt(45)));
+    EXPECT_EQ(-1, jacobi(BigInt(2), BigInt(45)));
+    EXPECT_EQ(0, jacobi(BigInt(30), BigInt(45)));
+}
+
+TEST_F(MathJacobi_tests, jacobiMatchesEulerCriterionForPrimes)
+{
+    const BigInt primes[] = {BigInt(1000000007), BigInt("170141183460469231731687303715884105727"),
+                             (BigInt(1) << 521) - BigInt(1)};
+    for (const auto &p : primes)
+    {
+        BigInt a("123456789123456789123456789");
+        for (int i = 0; i < 20; ++i)
+        {
+            a = (a * a + BigInt(i)) % (p << 100);
+            EXPECT_EQ(euler_criterion(a % p, p), jacobi(a, p));
+            EXPECT_EQ(1, jacobi(a * a, p) * jacobi(a * a, p));
+        }
+    }
+}
+
+TEST_F(MathJacobi_tests, jacobiIsMultiplicativeInDenominator)
+{
+    const BigInt p("170141183460469231731687303715884105727");
+    const auto q = (BigInt(1) << 521) - BigInt(1);
+    const auto n = p * q;
+
+    BigInt a("98765432109876543210987654321");
+    for (int i = 0; i < 20; ++i)
+    {
+        a = (a * a + BigInt(i)) % (n << 100);
+        EXPECT_EQ(jacobi(a, p) * jacobi(a, q), jacobi(a, n));
+        EXPECT_EQ(jacobi(a, p) * jacobi(a, q), jacobi(a % n, n));
+    }
+
+    EXPECT_EQ(0, jacobi(p * BigInt(12345), n));
+}
+
+TEST_F(MathJacobi_tests, jacobiOfHugeNumbers)
+{
+    const BigInt a("266093848339456467979588552314020980939114876036669977848521411164403931447983079208711193233444"
+                   "982894857428421322773756305451663384453038423821079695832480304710587190314545703292274140654242"
+                   "323660346991075949353029379700438657303969149257540471654394953047094688844591737453690961329476"
+                   "2527603194949");
+    const BigInt n("843164786324772254908744957107708895539512663689161277957084521400264216064696259494133314325763"
+                   "789358004603374034321040626223449454012675050214349486853506467493618936767751448326873755991380"
+                   "3163577439443126312611141389331471310827549645234323937678412968516050841465753");
+    EXPECT_EQ(1, jacobi(a, n));
+
+    const auto m127 = (BigInt(1) << 127) - BigInt(1);
+    const auto m89 = (BigInt(1) << 89) - BigInt(1);
+    EXPECT_EQ(1, jacobi(BigInt(3), m127 * m89));
+    EXPECT_EQ(-1, jacobi(BigInt(5), m127 * m89));
+    EXPECT_EQ(-1, jacobi(BigInt(7), m127 * m89));
+    EXPECT_EQ(1, jacobi((BigInt(1) << 200) + BigInt(1), m127 * m89));
+}
+
+TEST_F(MathJacobi_tests, jacobiThrowsForInvalidDenominator)
+{
+    EXPECT_THROW(jacobi(BigInt(3), BigInt(0)), std::invalid_argument);
+    EXPECT_THROW(jacobi(BigInt(3), BigInt(10)), std::invalid_argument);
+    EXPECT_THROW(jacobi(BigInt(3), BigInt(-7)), std::invalid_argument);
+}
+
+TEST_F(MathJacobi_tests, kroneckerSymbol)
+{
+    EXPECT_EQ(jacobi(BigInt(19), BigInt(45)), kronecker(BigInt(19), BigInt(45)));
+    EXPECT_EQ(1, kronecker(BigInt(1), BigInt(0)));
+    EXPECT_EQ(1, kronecker(BigInt(-1), BigInt(0)));
+    EXPECT_EQ(0, kronecker(BigInt(2), BigInt(0)));
+    EXPECT_EQ(0, kronecker(BigInt(6), BigInt(4)));
+    EXPECT_EQ(1, kronecker(BigInt(7), BigInt(2)));
+    EXPECT_EQ(-1, kronecker(BigInt(5), BigInt(2)));
+    EXPECT_EQ(-1, kronecker(BigInt(-5), BigInt(2)));
+    EXPECT_EQ(1, kronecker(BigInt(-7), BigInt(2)));
+    EXPECT_EQ(1, kronecker(BigInt(5), BigInt(4)));
+    EXPECT_EQ(1, kronecker(BigInt(5), BigInt(-1)));
+    EXPECT_EQ(-1, kronecker(BigInt(-5), BigInt(-1)));
+    EXPECT_EQ(1, kronecker(BigInt(3), BigInt(10)));
+    EXPECT_EQ(-1, kronecker(BigInt(-3), BigInt(-10)));
+}
@@ -21,3 +21,21 @@ TEST_F(MathModInverse_tests, modInverseFor2And6DoesNotExist)
 {
     ASSERT_THROW({ mod_inverse(BigInt(2), BigInt(6)); }, std::runtime_error);
 }
+
+TEST_F(MathModInverse_tests, modInverseOfNegativeNumber)
+{
+    EXPECT_EQ(BigInt(2), mod_inverse(BigInt(-3), BigInt(7)));
+}
+
+TEST_F(MathModInverse_tests, modInverseForBigPrimeModulus)
+{
+    for (const uint64_t exponent : {521, 4423, 9941})
+    {
+        const BigInt n = (BigInt(1) << exponent) - BigInt(1);
+        const BigInt a = pow(BigInt(3), BigInt(exponent));
+        const BigInt inverse = mod_inverse(a, n);
+
+        EXPECT_LT(inverse, n);
+        EXPECT_EQ(BigInt(1), (inverse * a) % n);
+    }
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/Montgomery.h>
+
+#include <stdexcept>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathMontgomery_tests : public ::testing::Test
+{
+};
+
+TEST_F(MathMontgomery_tests, throwsForInvalidModulus)
+{
+    ASSERT_THROW({ MontgomeryContext context(BigInt(1)); }, std::invalid_argument);
+    ASSERT_THROW({ MontgomeryContext context(BigInt(10)); }, std::invalid_argument);
+    ASSERT_THROW({ MontgomeryContext context(BigInt(-7)); }, std::invalid_argument);
+}
+
+TEST_F(MathMontgomery_tests, conversionRoundTrip)
+{
+    const MontgomeryContext context(BigInt(1000003));
+
+    EXPECT_EQ(BigInt(12345), context.from_montgomery(context.to_montgomery(BigInt(12345))));
+    EXPECT_EQ(BigInt(1000002), context.from_montgomery(context.to_montgomery(BigInt(-1))));
+    EXPECT_EQ(BigInt(1), context.from_montgomery(context.one()));
+}
+
+TEST_F(MathMontgomery_tests, multiplicationMatchesPlainModularMultiplication)
+{
+    for (const uint64_t bits : {61, 521, 1279, 4253, 9689, 44497})
+    {
+        const BigInt n = (BigInt(1) << bits) - BigInt(1);
+        const MontgomeryContext context(n);
+        const BigInt a = pow(BigInt(3), BigInt(bits)) % n;
+        const BigInt b = pow(BigInt(7), BigInt(bits)) % n;
+
+        const auto product = context.multiply(context.to_montgomery(a), context.to_montgomery(b));
+        EXPECT_EQ((a * b) % n, context.from_montgomery(product));
+
+        const auto square = context.square(context.to_montgomery(a));
+        EXPECT_EQ((a * a) % n, context.from_montgomery(square));
+    }
+}
+
+TEST_F(MathMontgomery_tests, multiplicationResultIsFullyReduced)
+{
+    const BigInt n = (BigInt(1) << 256) - BigInt(189);
+    const MontgomeryContext context(n);
+    const BigInt almost_n = n - BigInt(1);
+
+    const auto result = context.multiply(almost_n, almost_n);
+    EXPECT_LT(result, n);
+    EXPECT_EQ(result, context.to_montgomery(context.from_montgomery(result)) % n);
+}
+
+TEST_F(MathMontgomery_tests, powMatchesPlainExponentiation)
+{
+    const BigInt n = (BigInt(1) << 300) + BigInt(157);
+    const MontgomeryContext context(n);
+    const auto base = context.to_montgomery(BigInt(123456789));
+
+    EXPECT_EQ(BigInt("855094858145655819965551828358806602525691817036679504516635927977813052683987147612541194"),
+              context.from_montgomery(context.pow(base, (BigInt(1) << 200) + BigInt(1))));
+    EXPECT_EQ(context.one(), context.pow(base, BigInt(0)));
+    EXPECT_EQ(base, context.pow(base, BigInt(1)));
+
+    for (const uint64_t exponent : {2, 3, 7, 64, 255, 1000})
+    {
+        EXPECT_EQ(pow(BigInt(123456789), BigInt(exponent)) % n,
+                  context.from_montgomery(context.pow(base, BigInt(exponent))));
+    }
+}
+
+TEST_F(MathMontgomery_tests, powThrowsForNegativeExponent)
+{
+    const MontgomeryContext context(BigInt(1000003));
+    ASSERT_THROW(context.pow(context.one(), BigInt(-1)), std::invalid_argument);
+}
+
+TEST_F(MathMontgomery_tests, constantTimePowMatchesPow)
+{
+    const BigInt moduli[] = {BigInt(3), BigInt(1000003), (BigInt(1) << 300) + BigInt(157),
+                             (BigInt(1) << 2048) - BigInt(159)};
+    for (const auto &n : moduli)
+    {
+        const MontgomeryContext context(n);
+        const auto base = context.to_montgomery(BigInt("98765432109876543210987654321"));
+        EXPECT_EQ(context.one(), context.pow_consttime(base, BigInt(0)));
+        EXPECT_EQ(base, context.pow_consttime(base, BigInt(1)));
+        EXPECT_EQ(context.pow_consttime(context.one(), n), context.one());
+
+        for (const auto &exponent : {BigInt(2), BigInt(31), BigInt(32), BigInt(1000), (BigInt(1) << 200) - BigInt(1),
+                                     n - BigInt(2), (n << 3) + BigInt(5)})
+        {
+            EXPECT_EQ(context.pow(base, exponent), context.pow_consttime(base, exponent));
+        }
+    }
+}
+
+TEST_F(MathMontgomery_tests, constantTimePowOfZeroBase)
+{
+    const MontgomeryContext context((BigInt(1) << 300) + BigInt(157));
+    EXPECT_EQ(BigInt(0), context.pow_consttime(BigInt(0), BigInt(12345)));
+    EXPECT_EQ(context.one(), context.pow_consttime(BigInt(0), BigInt(0)));
+    ASSERT_THROW(context.pow_consttime(context.one(), BigInt(-1)), std::invalid_argument);
+}
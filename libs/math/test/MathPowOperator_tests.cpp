@@ -95,9 +95,42 @@ TEST_F(BigIntPowOperator_tests, powModularArithmetic)
     EXPECT_EQ(BigInt(9), pow(base, exponent, mod));
 }
 
+TEST_F(BigIntPowOperator_tests, powModularArithmeticWithBigOddModulus)
+{
+    const BigInt mod = (BigInt(1) << 521) - BigInt(1);
+    const BigInt exponent = pow(BigInt(10), BigInt(150)) + BigInt(12345);
+
+    EXPECT_EQ(BigInt("3029961048035688898693850747168603426477027981959677011573920415828421553847558356657417750150"
+                     "404582915500522248866459050393707146312687561544319057960741360"),
+              pow(BigInt(3), exponent, mod));
+    EXPECT_EQ(BigInt(1), pow(BigInt(3), mod - BigInt(1), mod));
+    EXPECT_EQ(BigInt(0), pow(mod, BigInt(5), mod));
+}
+
 TEST_F(BigIntPowOperator_tests, powModularArithmeticThrowsOnNegativeInput)
 {
     ASSERT_THROW({ pow(BigInt(-1), BigInt(1), BigInt(1)); }, std::invalid_argument);
     ASSERT_THROW({ pow(BigInt(1), BigInt(-1), BigInt(1)); }, std::invalid_argument);
     ASSERT_THROW({ pow(BigInt(1), BigInt(1), BigInt(-1)); }, std::invalid_argument);
 }
+
+TEST_F(BigIntPowOperator_tests, constantTimePowMatchesPow)
+{
+    const BigInt mod = (BigInt(1) << 521) - BigInt(1);
+    const BigInt exponent = pow(BigInt(10), BigInt(150)) + BigInt(12345);
+
+    EXPECT_EQ(pow(BigInt(3), exponent, mod), pow_consttime(BigInt(3), exponent, mod));
+    EXPECT_EQ(BigInt(1), pow_consttime(BigInt(3), mod - BigInt(1), mod));
+    EXPECT_EQ(BigInt(0), pow_consttime(mod, BigInt(5), mod));
+    EXPECT_EQ(BigInt(1), pow_consttime(BigInt(7), BigInt(0), mod));
+    EXPECT_EQ(BigInt(4), pow_consttime(BigInt(2) + BigInt(11) * mod, BigInt(2), BigInt(11)));
+}
+
+TEST_F(BigIntPowOperator_tests, constantTimePowThrowsOnInvalidInput)
+{
+    ASSERT_THROW({ pow_consttime(BigInt(-1), BigInt(1), BigInt(7)); }, std::invalid_argument);
+    ASSERT_THROW({ pow_consttime(BigInt(1), BigInt(-1), BigInt(7)); }, std::invalid_argument);
+    ASSERT_THROW({ pow_consttime(BigInt(1), BigInt(1), BigInt(-7)); }, std::invalid_argument);
+    ASSERT_THROW({ pow_consttime(BigInt(1), BigInt(1), BigInt(8)); }, std::invalid_argument);
+    ASSERT_THROW({ pow_consttime(BigInt(1), BigInt(1), BigInt(1)); }, std::invalid_argument);
+}
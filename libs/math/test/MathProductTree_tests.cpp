@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+#include <yabil/math/ProductTree.h>
+
+#include <vector>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathProductTree_tests : public ::testing::Test
+{
+};
+
+TEST_F(MathProductTree_tests, treeWithoutLeaves)
+{
+    const ProductTree tree(std::vector<BigInt>{});
+    EXPECT_EQ(0, tree.size());
+    EXPECT_EQ(BigInt(1), tree.product());
+    EXPECT_TRUE(tree.remainder_tree(BigInt(123)).empty());
+}
+
+TEST_F(MathProductTree_tests, treeLevelsContainProductsOfChildren)
+{
+    const std::vector<BigInt> numbers = {BigInt(2), BigInt(3), BigInt(5), BigInt(7), BigInt(11)};
+    const ProductTree tree(numbers);
+
+    EXPECT_EQ(5, tree.size());
+    EXPECT_EQ(4, tree.height());
+    EXPECT_EQ(numbers, tree.level(0));
+    EXPECT_EQ(std::vector<BigInt>({BigInt(6), BigInt(35), BigInt(11)}), tree.level(1));
+    EXPECT_EQ(std::vector<BigInt>({BigInt(210), BigInt(11)}), tree.level(2));
+    EXPECT_EQ(BigInt(2310), tree.product());
+}
+
+TEST_F(MathProductTree_tests, remainderTreeOfSmallNumbers)
+{
+    const std::vector<BigInt> numbers = {BigInt(2), BigInt(3), BigInt(5), BigInt(7), BigInt(11)};
+    const ProductTree tree(numbers);
+
+    EXPECT_EQ(std::vector<BigInt>({BigInt(1), BigInt(1), BigInt(3), BigInt(4), BigInt(4)}),
+              tree.remainder_tree(BigInt(1000003)));
+    EXPECT_EQ(std::vector<BigInt>({BigInt(1), BigInt(2), BigInt(2), BigInt(3), BigInt(7)}),
+              tree.remainder_tree(BigInt(-1000003)));
+}
+
+TEST_F(MathProductTree_tests, remainderTreeMatchesModulo)
+{
+    std::vector<BigInt> numbers;
+    for (int i = 0; i < 300; ++i)
+    {
+        numbers.push_back(pow(BigInt(3), BigInt(i % 40 + 1)) + BigInt(i));
+    }
+
+    const BigInt x = pow(BigInt(7), BigInt(3000)) + BigInt(12345);
+    const ProductTree tree(numbers);
+    const auto remainders = tree.remainder_tree(x);
+
+    ASSERT_EQ(numbers.size(), remainders.size());
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+    {
+        EXPECT_EQ(x % numbers[i], remainders[i]);
+    }
+}
+
+TEST_F(MathProductTree_tests, parallelTreeMatchesTree)
+{
+    std::vector<BigInt> numbers;
+    for (int i = 1; i < 1000; ++i)
+    {
+        numbers.push_back((BigInt(i) << 100) + BigInt(1));
+    }
+
+    const ProductTree tree(numbers);
+    const auto parallel_tree = parallel::product_tree(numbers);
+    const BigInt x = pow(BigInt(11), BigInt(10000));
+
+    EXPECT_EQ(tree.product(), parallel_tree.product());
+    EXPECT_EQ(tree.remainder_tree(x), parallel::remainder_tree(parallel_tree, x));
+}
@@ -61,3 +61,69 @@ TEST_F(MathRoot_tests, rootAcceptanceTests)
     EXPECT_EQ(BigInt(1), root(BigInt(5), BigInt(5)));
     EXPECT_EQ(BigInt(7), root(BigInt(99999999), BigInt(9)));
 }
+
+TEST_F(MathRoot_tests, rootWithIntegerDegree)
+{
+    EXPECT_EQ(BigInt(3), root(BigInt(27), 3));
+    EXPECT_EQ(BigInt(41), root(BigInt(123456789), 5));
+    EXPECT_EQ(BigInt(1), root(BigInt(123456789), 100));
+    ASSERT_THROW({ root(BigInt(10), 0); }, std::invalid_argument);
+}
+
+TEST_F(MathRoot_tests, rootremReturnsRemainder)
+{
+    EXPECT_EQ(std::make_pair(BigInt(0), BigInt(0)), rootrem(BigInt(0), 7));
+    EXPECT_EQ(std::make_pair(BigInt(3), BigInt(0)), rootrem(BigInt(27), 3));
+    EXPECT_EQ(std::make_pair(BigInt(41), BigInt(7600588)), rootrem(BigInt(123456789), 5));
+    EXPECT_EQ(std::make_pair(BigInt(1), BigInt(99)), rootrem(BigInt(100), 7));
+}
+
+TEST_F(MathRoot_tests, rootremOfBigNumbers)
+{
+    const BigInt n = pow(BigInt(7), BigInt(5000)) + BigInt(123);
+    for (const uint64_t k : {3, 4, 5, 17, 64, 1000})
+    {
+        const auto [root, remainder] = rootrem(n, k);
+        EXPECT_EQ(n, pow(root, BigInt(k)) + remainder);
+        EXPECT_FALSE(remainder.is_negative());
+        EXPECT_GT(pow(root + BigInt(1), BigInt(k)), n);
+    }
+}
+
+TEST_F(MathRoot_tests, rootOfExactPower)
+{
+    const BigInt base = pow(BigInt(3), BigInt(200)) + BigInt(2);
+    for (const uint64_t k : {3, 5, 8, 31})
+    {
+        EXPECT_EQ(std::make_pair(base, BigInt(0)), rootrem(pow(base, BigInt(k)), k));
+        EXPECT_EQ(base - BigInt(1), root(pow(base, BigInt(k)) - BigInt(1), k));
+    }
+}
+
+TEST_F(MathRoot_tests, isPerfectPowerForSmallNumbers)
+{
+    for (const int n : {0, 1, -1, 4, 8, 9, 27, 32, 36, 100, 125, -125, 1024, 3125})
+    {
+        EXPECT_TRUE(is_perfect_power(BigInt(n)));
+    }
+
+    for (const int n : {2, 3, 6, 10, 12, 18, 24, 99, 200, -4, -36, 1023})
+    {
+        EXPECT_FALSE(is_perfect_power(BigInt(n)));
+    }
+}
+
+TEST_F(MathRoot_tests, isPerfectPowerForBigNumbers)
+{
+    const BigInt base = pow(BigInt(10), BigInt(50)) + BigInt(7);
+    for (const uint64_t k : {2, 3, 6, 7, 11})
+    {
+        const auto n = pow(base, BigInt(k));
+        EXPECT_TRUE(is_perfect_power(n));
+        EXPECT_FALSE(is_perfect_power(n + BigInt(1)));
+        EXPECT_FALSE(is_perfect_power(n << 1));
+    }
+    EXPECT_TRUE(is_perfect_power(BigInt(1) << 1000));
+    EXPECT_TRUE(is_perfect_power(BigInt(1) << 997));
+    EXPECT_FALSE(is_perfect_power(BigInt(3) << 997));
+}
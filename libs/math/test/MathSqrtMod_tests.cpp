@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <yabil/bigint/BigInt.h>
+#include <yabil/math/Math.h>
+
+#include <stdexcept>
+
+using namespace yabil::math;
+using namespace yabil::bigint;
+
+class MathSqrtMod_tests : public ::testing::Test
+{
+};
+
+namespace
+{
+
+void expect_square_roots(const BigInt &p)
+{
+    BigInt x("123456789012345678901234567890123456789");
+    for (int i = 0; i < 10; ++i)
+    {
+        x = (x * x + BigInt(i)) % p;
+        const auto a = (x * x) % p;
+        const auto root = sqrt_mod(a, p);
+
+        EXPECT_EQ(a, (root * root) % p);
+        EXPECT_EQ(x < p - x ? x : p - x, root);
+    }
+}
+
+}  // namespace
+
+TEST_F(MathSqrtMod_tests, sqrtModOfSmallNumbers)
+{
+    EXPECT_EQ(BigInt(0), sqrt_mod(BigInt(0), BigInt(7)));
+    EXPECT_EQ(BigInt(1), sqrt_mod(BigInt(1), BigInt(2)));
+    EXPECT_EQ(BigInt(2), sqrt_mod(BigInt(4), BigInt(7)));
+    EXPECT_EQ(BigInt(3), sqrt_mod(BigInt(2), BigInt(7)));
+    EXPECT_EQ(BigInt(6), sqrt_mod(BigInt(2), BigInt(17)));
+    EXPECT_EQ(BigInt(10), sqrt_mod(BigInt(3), BigInt(97)));
+    EXPECT_EQ(BigInt(3), sqrt_mod(BigInt(-4), BigInt(13)));
+}
+
+TEST_F(MathSqrtMod_tests, sqrtModForPrimesCongruentTo3Mod4)
+{
+    expect_square_roots(BigInt(1000000007));
+    expect_square_roots((BigInt(1) << 127) - BigInt(1));
+    expect_square_roots((BigInt(1) << 521) - BigInt(1));
+}
+
+TEST_F(MathSqrtMod_tests, sqrtModForPrimesCongruentTo5Mod8)
+{
+    expect_square_roots(BigInt(13));
+    expect_square_roots((BigInt(1) << 255) - BigInt(19));
+}
+
+TEST_F(MathSqrtMod_tests, sqrtModForPrimesCongruentTo1Mod8)
+{
+    expect_square_roots(BigInt(998244353));
+    expect_square_roots(BigInt("10000000000000000000000000000000000000121"));
+    expect_square_roots(BigInt("1000000000000000000000000000000000000000000000000000000006721"));
+    expect_square_roots((BigInt(1) << 224) - (BigInt(1) << 96) + BigInt(1));
+}
+
+TEST_F(MathSqrtMod_tests, sqrtModThrowsForNonResidue)
+{
+    EXPECT_THROW(sqrt_mod(BigInt(3), BigInt(7)), std::runtime_error);
+    EXPECT_THROW(sqrt_mod(BigInt(3), BigInt(17)), std::runtime_error);
+    EXPECT_THROW(sqrt_mod(BigInt(2), (BigInt(1) << 255) - BigInt(19)), std::runtime_error);
+}
+
+TEST_F(MathSqrtMod_tests, sqrtModThrowsForInvalidModulus)
+{
+    EXPECT_THROW(sqrt_mod(BigInt(4), BigInt(0)), std::invalid_argument);
+    EXPECT_THROW(sqrt_mod(BigInt(4), BigInt(1)), std::invalid_argument);
+    EXPECT_THROW(sqrt_mod(BigInt(4), BigInt(-7)), std::invalid_argument);
+    EXPECT_THROW(sqrt_mod(BigInt(3), BigInt(10)), std::invalid_argument);
+    EXPECT_THROW(sqrt_mod(BigInt(4), BigInt(9)), std::invalid_argument);
+    EXPECT_THROW(sqrt_mod(BigInt(4), BigInt(15)), std::invalid_argument);
+}
@@ -39,3 +39,36 @@ TEST_F(MathSqrt_tests, sqrtOfNegativeShouldThrow)
 {
     ASSERT_THROW({ std::ignore = sqrt(BigInt(-1)); }, std::invalid_argument);
 }
+
+TEST_F(MathSqrt_tests, sqrtremReturnsRemainder)
+{
+    EXPECT_EQ(std::make_pair(BigInt(0), BigInt(0)), sqrtrem(BigInt(0)));
+    EXPECT_EQ(std::make_pair(BigInt(1), BigInt(1)), sqrtrem(BigInt(2)));
+    EXPECT_EQ(std::make_pair(BigInt(128), BigInt(0)), sqrtrem(BigInt(16384)));
+    EXPECT_EQ(std::make_pair(BigInt("3305826693656"), BigInt("2251223166567")),
+              sqrtrem(BigInt("10928490128490812093812903")));
+}
+
+TEST_F(MathSqrt_tests, sqrtremOfBigNumbers)
+{
+    for (const uint64_t exponent : {40, 41, 100, 333, 1000, 4001})
+    {
+        const BigInt n = pow(BigInt(3), BigInt(exponent)) + BigInt(exponent);
+        const auto [root, remainder] = sqrtrem(n);
+
+        EXPECT_EQ(n, root * root + remainder);
+        EXPECT_FALSE(remainder.is_negative());
+        EXPECT_LE(remainder, root << 1);
+    }
+}
+
+TEST_F(MathSqrt_tests, sqrtOfPerfectSquares)
+{
+    for (const uint64_t exponent : {31, 32, 33, 64, 65, 127, 128, 129, 1000})
+    {
+        const BigInt root = (BigInt(1) << exponent) - BigInt(1);
+        EXPECT_EQ(std::make_pair(root, BigInt(0)), sqrtrem(root * root));
+        EXPECT_EQ(root - BigInt(1), sqrt(root * root - BigInt(1)));
+        EXPECT_EQ(root, sqrt(root * root + (root << 1)));
+    }
+}
@@ -56,6 +56,12 @@ public:
     /// @return Number of currently running tasks
     YABIL_UTILS_EXPORT unsigned currently_running_tasks_count() const;
 
+    /// @brief Checks if caller is running on one of the threads of this pool.
+    /// @details Tasks running on the pool should not block waiting for other tasks submitted to the same pool,
+    ///          as all threads may become blocked this way.
+    /// @return \p true if called from a worker thread of this pool and \p false otherwise
+    YABIL_UTILS_EXPORT bool is_current_thread_worker() const;
+
     /// @brief Checks if threads are active.
     /// @return \p true if threads are active and \p false otherwise
     YABIL_UTILS_EXPORT bool is_active() const;
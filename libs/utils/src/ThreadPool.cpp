@@ -7,6 +7,13 @@
 namespace yabil::utils
 {
 
+namespace
+{
+
+thread_local const ThreadPool *current_thread_pool = nullptr;
+
+}  // namespace
+
 ThreadPool::ThreadPool(int concurrency)
 {
     if (concurrency == 0)
@@ -85,6 +92,11 @@ std::size_t ThreadPool::thread_count() const
     return threads.size();
 }
 
+bool ThreadPool::is_current_thread_worker() const
+{
+    return current_thread_pool == this;
+}
+
 bool ThreadPool::is_active() const
 {
     return !should_stop;
@@ -93,6 +105,7 @@ bool ThreadPool::is_active() const
 void ThreadPool::worker()
 {
     const auto thread_id = std::this_thread::get_id();
+    current_thread_pool = this;
     {
         const std::lock_guard guard(thread_status_mutex);
         thread_statuses[thread_id] = ThreadStatus::Running;
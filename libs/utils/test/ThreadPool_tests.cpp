@@ -108,3 +108,13 @@ TEST_F(ThreadPool_tests, canUseManyThreadPools)
         ASSERT_NE(status, std::future_status::timeout);
     }
 }
+
+TEST_F(ThreadPool_tests, canDetectWorkerThread)
+{
+    ThreadPool pool(1);
+    ThreadPool other_pool(1);
+
+    EXPECT_FALSE(pool.is_current_thread_worker());
+    EXPECT_TRUE(pool.submit([&]() { return pool.is_current_thread_worker(); }).get());
+    EXPECT_FALSE(other_pool.submit([&]() { return pool.is_current_thread_worker(); }).get());
+}